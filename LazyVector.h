@@ -15,12 +15,203 @@
 #include <cstring>
 #include <iterator>
 #include <stdexcept>
+#include <cstdint>
+#include <algorithm>
+#include <memory>
+#include <limits>
+#include <functional>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <string>
+#include <ostream>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <future>
+#include <deque>
+#include <new>
+#include <optional>
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+#if defined(LAZY_VECTOR_PROFILING) || defined(LAZY_VECTOR_FOOTPRINT)
+#include <map>
+#include <tuple>
+#include <string_view>
+#endif
+#if defined(LAZY_VECTOR_STD_EXECUTION)
+#include <execution>
+#endif
+#if defined(LAZY_VECTOR_PERF_COUNTERS) && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+#if (__cplusplus >= 202002L) && defined(__has_include)
+#if __has_include(<source_location>)
+#include <source_location>
+#endif
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#define LAZY_VECTOR_COROUTINES
+#endif
+#endif
+
+// element wise evaluation path is force inlined (otherwise compilers give up inlining it in large translation units, which prevents vectorization)
+#if defined(_MSC_VER)
+#define LAZY_VECTOR_INLINE __forceinline
+#elif defined(__GNUC__) || defined(__clang__)
+#define LAZY_VECTOR_INLINE inline __attribute__((always_inline))
+#else
+#define LAZY_VECTOR_INLINE inline
+#endif
+
+// cold paths kept out of line (inlining them into callers' loops costs registers and code size on the hot path)
+#if defined(_MSC_VER)
+#define LAZY_VECTOR_NOINLINE inline __declspec(noinline)
+#elif defined(__GNUC__) || defined(__clang__)
+#define LAZY_VECTOR_NOINLINE inline __attribute__((noinline))
+#else
+#define LAZY_VECTOR_NOINLINE inline
+#endif
+
+// loop hint - iterations are independent (element wise evaluation reads and writes position i only), so aliasing checks can be skipped
+#if defined(__clang__)
+#define LAZY_VECTOR_VECTORIZE _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#define LAZY_VECTOR_VECTORIZE _Pragma("GCC ivdep")
+#elif defined(_MSC_VER)
+#define LAZY_VECTOR_VECTORIZE __pragma(loop(ivdep))
+#else
+#define LAZY_VECTOR_VECTORIZE
+#endif
 
 /**
 * Lazy Vector exteds std::vector with lazy evaluated operators.
 **/
 namespace Lazy {
 
+    /**
+    * binary operations
+    **/
+    namespace BinaryOperations {
+
+        // numerical/bit operator overloading
+// kind - operation index (0 to Kinds - 1), symbol - operator as written
+#define CREATE_BINARY_OPERATION(xi_name, xi_operator, xi_assign_operator, xi_kind)                                 \
+    template<typename T> struct xi_name {                                                                          \
+        static constexpr std::size_t kind{ xi_kind };                                                              \
+        static constexpr const char* symbol{ #xi_operator };                                                       \
+        LAZY_VECTOR_INLINE static T apply(const T& a, const T& b) { return a xi_operator b; }                      \
+        LAZY_VECTOR_INLINE static T apply(T&& a,      const T& b) { a xi_assign_operator b; return std::move(a); } \
+        LAZY_VECTOR_INLINE static T apply(const T& a, T&& b)      { b xi_assign_operator a; return std::move(b); } \
+        LAZY_VECTOR_INLINE static T apply(T&& a,      T&& b)      { a xi_assign_operator b; return std::move(a); } \
+    }
+
+        CREATE_BINARY_OPERATION(ADD, +, +=, 0);
+        CREATE_BINARY_OPERATION(SUB, -, -=, 1);
+        CREATE_BINARY_OPERATION(MUL, *, *=, 2);
+        CREATE_BINARY_OPERATION(DIV, / , /=, 3);
+        CREATE_BINARY_OPERATION(LOR, | , |=, 4);
+        CREATE_BINARY_OPERATION(LAND, &, &=, 5);
+        CREATE_BINARY_OPERATION(LXOR, ^, ^=, 6);
+        CREATE_BINARY_OPERATION(SHL, << , <<=, 7);
+        CREATE_BINARY_OPERATION(SHR, >> , >>=, 8);
+#undef CREATE_BINARY_OPERATION
+
+        // relation/logical operator overloading
+#define CREATE_BINARY_OPERATION(xi_name, xi_operator, xi_kind)                                \
+    template<typename T> struct xi_name {                                                     \
+        static constexpr std::size_t kind{ xi_kind };                                         \
+        static constexpr const char* symbol{ #xi_operator };                                  \
+        LAZY_VECTOR_INLINE static T apply(const T& a, const T& b) { return a xi_operator b; } \
+        LAZY_VECTOR_INLINE static T apply(T&& a,      const T& b) { return a xi_operator b; } \
+        LAZY_VECTOR_INLINE static T apply(const T& a, T&& b)      { return a xi_operator b; } \
+        LAZY_VECTOR_INLINE static T apply(T&& a,      T&& b)      { return a xi_operator b; } \
+    }
+
+        CREATE_BINARY_OPERATION(AND, &&, 9);
+        CREATE_BINARY_OPERATION(OR, ||, 10);
+        CREATE_BINARY_OPERATION(EQ, ==, 11);
+        CREATE_BINARY_OPERATION(NEQ, !=, 12);
+        CREATE_BINARY_OPERATION(LT, <, 13);
+        CREATE_BINARY_OPERATION(LE, <=, 14);
+        CREATE_BINARY_OPERATION(GT, >, 15);
+        CREATE_BINARY_OPERATION(GE, >=, 16);
+#undef CREATE_BINARY_OPERATION
+
+        // amount of binary operations
+        constexpr std::size_t Kinds{ 17 };
+
+        // operator of a binary operation kind
+        constexpr const char* symbol(const std::size_t xi_kind) noexcept {
+            constexpr const char* symbols[Kinds]{ "+", "-", "*", "/", "|", "&", "^", "<<", ">>", "&&", "||", "==", "!=", "<", "<=", ">", ">=" };
+            return (xi_kind < Kinds) ? symbols[xi_kind] : "?";
+        }
+
+    };
+
+    /**
+    * assignment operations (used by the evaluator to write an expression value into a destination)
+    **/
+    namespace AssignOperations {
+
+// kind - operation index (0 to Kinds - 1), symbol - operator as written
+#define CREATE_ASSIGN_OPERATION(xi_name, xi_operator, xi_kind)                                                                   \
+    struct xi_name {                                                                                                             \
+        static constexpr std::size_t kind{ xi_kind };                                                                            \
+        static constexpr const char* symbol{ #xi_operator };                                                                     \
+        template<typename T, typename U> LAZY_VECTOR_INLINE static void apply(T& a, U&& b) { a xi_operator std::forward<U>(b); } \
+    }
+
+        CREATE_ASSIGN_OPERATION(ASSIGN, =, 0);
+        CREATE_ASSIGN_OPERATION(ADD, +=, 1);
+        CREATE_ASSIGN_OPERATION(SUB, -=, 2);
+        CREATE_ASSIGN_OPERATION(MUL, *=, 3);
+        CREATE_ASSIGN_OPERATION(DIV, /=, 4);
+        CREATE_ASSIGN_OPERATION(LOR, |=, 5);
+        CREATE_ASSIGN_OPERATION(LAND, &=, 6);
+        CREATE_ASSIGN_OPERATION(LXOR, ^=, 7);
+        CREATE_ASSIGN_OPERATION(SHL, <<=, 8);
+        CREATE_ASSIGN_OPERATION(SHR, >>=, 9);
+#undef CREATE_ASSIGN_OPERATION
+
+        // amount of assignment operations
+        constexpr std::size_t Kinds{ 10 };
+
+        // operator of an assignment operation kind
+        constexpr const char* symbol(const std::size_t xi_kind) noexcept {
+            constexpr const char* symbols[Kinds]{ "=", "+=", "-=", "*=", "/=", "|=", "&=", "^=", "<<=", ">>=" };
+            return (xi_kind < Kinds) ? symbols[xi_kind] : "?";
+        }
+
+    };
+
+    /**
+    * operand element access used by expressions and evaluators - vectors are read through their unchecked element() accessor
+    * (pending asynchronous assignments are waited for once per evaluation, by Async::readable), other operands through operator[]
+    **/
+    namespace Operands {
+
+        template<typename Operand, typename = void> struct Unchecked : std::false_type {};
+        template<typename Operand> struct Unchecked<Operand, std::void_t<decltype(std::declval<const Operand&>().element(std::size_t{}))>> : std::true_type {};
+
+        template<typename Operand> LAZY_VECTOR_INLINE decltype(auto) at(const Operand& xi_operand, const std::size_t xi_index) {
+            if constexpr (Unchecked<Operand>::value) {
+                return xi_operand.element(xi_index);
+            }
+            else {
+                return xi_operand[xi_index];
+            }
+        }
+    };
+
     /**
     * \brief a binary expression
     *
@@ -29,6 +220,10 @@ namespace Lazy {
     * @param {RightExpr, in} right side of expression
     **/
     template<typename LeftExpr, typename BinaryOp, typename RightExpr> class BinaryExpression {
+        // types
+        public:
+            using value_type = typename std::decay<LeftExpr>::type::value_type;
+
         // properties
         private:
             const LeftExpr m_left;
@@ -53,37 +248,37 @@ namespace Lazy {
         // binary operators overload
         public:
 
-#define CREATE_BINARY_EXPRESSION_OPERATOR(xi_operator)                                                                                                                                                      \
-        template<typename RE> auto operator xi_operator(RE&& re) const -> BinaryExpression<const BinaryExpression<LeftExpr, BinaryOp, RightExpr>&, BinaryOp, decltype(std::forward<RE>(re))> {  \
-            return BinaryExpression<const BinaryExpression<LeftExpr, BinaryOp, RightExpr>&, BinaryOp, decltype(std::forward<RE>(re))>(*this, std::forward<RE>(re));                             \
-        }
-
-        CREATE_BINARY_EXPRESSION_OPERATOR(+=);
-        CREATE_BINARY_EXPRESSION_OPERATOR(-=);
-        CREATE_BINARY_EXPRESSION_OPERATOR(*=);
-        CREATE_BINARY_EXPRESSION_OPERATOR(/=);
-        CREATE_BINARY_EXPRESSION_OPERATOR(|=);
-        CREATE_BINARY_EXPRESSION_OPERATOR(&=);
-        CREATE_BINARY_EXPRESSION_OPERATOR(^=);
-        CREATE_BINARY_EXPRESSION_OPERATOR(<<=);
-        CREATE_BINARY_EXPRESSION_OPERATOR(>>=);
-        CREATE_BINARY_EXPRESSION_OPERATOR(+);
-        CREATE_BINARY_EXPRESSION_OPERATOR(-);
-        CREATE_BINARY_EXPRESSION_OPERATOR(*);
-        CREATE_BINARY_EXPRESSION_OPERATOR(/);
-        CREATE_BINARY_EXPRESSION_OPERATOR(|);
-        CREATE_BINARY_EXPRESSION_OPERATOR(&);
-        CREATE_BINARY_EXPRESSION_OPERATOR(^);
-        CREATE_BINARY_EXPRESSION_OPERATOR(<<);
-        CREATE_BINARY_EXPRESSION_OPERATOR(>>);
-        CREATE_BINARY_EXPRESSION_OPERATOR(&&);
-        CREATE_BINARY_EXPRESSION_OPERATOR(||);
-        CREATE_BINARY_EXPRESSION_OPERATOR(==);
-        CREATE_BINARY_EXPRESSION_OPERATOR(!=);
-        CREATE_BINARY_EXPRESSION_OPERATOR(<);
-        CREATE_BINARY_EXPRESSION_OPERATOR(<=);
-        CREATE_BINARY_EXPRESSION_OPERATOR(>);
-        CREATE_BINARY_EXPRESSION_OPERATOR(>=);
+#define CREATE_BINARY_EXPRESSION_OPERATOR(xi_operator, xi_operation)                                                                                                                                                                    \
+        template<typename RE> auto operator xi_operator(RE&& re) const -> BinaryExpression<const BinaryExpression<LeftExpr, BinaryOp, RightExpr>&, BinaryOperations::xi_operation<value_type>, decltype(std::forward<RE>(re))> {  \
+            return BinaryExpression<const BinaryExpression<LeftExpr, BinaryOp, RightExpr>&, BinaryOperations::xi_operation<value_type>, decltype(std::forward<RE>(re))>(*this, std::forward<RE>(re));                             \
+        }
+
+        CREATE_BINARY_EXPRESSION_OPERATOR(+=, ADD);
+        CREATE_BINARY_EXPRESSION_OPERATOR(-=, SUB);
+        CREATE_BINARY_EXPRESSION_OPERATOR(*=, MUL);
+        CREATE_BINARY_EXPRESSION_OPERATOR(/=, DIV);
+        CREATE_BINARY_EXPRESSION_OPERATOR(|=, LOR);
+        CREATE_BINARY_EXPRESSION_OPERATOR(&=, LAND);
+        CREATE_BINARY_EXPRESSION_OPERATOR(^=, LXOR);
+        CREATE_BINARY_EXPRESSION_OPERATOR(<<=, SHL);
+        CREATE_BINARY_EXPRESSION_OPERATOR(>>=, SHR);
+        CREATE_BINARY_EXPRESSION_OPERATOR(+, ADD);
+        CREATE_BINARY_EXPRESSION_OPERATOR(-, SUB);
+        CREATE_BINARY_EXPRESSION_OPERATOR(*, MUL);
+        CREATE_BINARY_EXPRESSION_OPERATOR(/, DIV);
+        CREATE_BINARY_EXPRESSION_OPERATOR(|, LOR);
+        CREATE_BINARY_EXPRESSION_OPERATOR(&, LAND);
+        CREATE_BINARY_EXPRESSION_OPERATOR(^, LXOR);
+        CREATE_BINARY_EXPRESSION_OPERATOR(<<, SHL);
+        CREATE_BINARY_EXPRESSION_OPERATOR(>>, SHR);
+        CREATE_BINARY_EXPRESSION_OPERATOR(&&, AND);
+        CREATE_BINARY_EXPRESSION_OPERATOR(||, OR);
+        CREATE_BINARY_EXPRESSION_OPERATOR(==, EQ);
+        CREATE_BINARY_EXPRESSION_OPERATOR(!=, NEQ);
+        CREATE_BINARY_EXPRESSION_OPERATOR(<, LT);
+        CREATE_BINARY_EXPRESSION_OPERATOR(<=, LE);
+        CREATE_BINARY_EXPRESSION_OPERATOR(>, GT);
+        CREATE_BINARY_EXPRESSION_OPERATOR(>=, GE);
 #undef CREATE_BINARY_EXPRESSION_OPERATOR
 
         // getters
@@ -91,775 +286,6187 @@ namespace Lazy {
 
             // expression left hand side
             auto le()       -> typename std::add_lvalue_reference<                        LeftExpr>       ::type { return m_left; }
-            auto le() const -> typename std::add_lvalue_reference<typename std::add_const<LeftExpr>::type>::type { return m_left; }
+            auto le() const -> typename std::add_lvalue_reference<typename std::add_const<typename std::remove_reference<LeftExpr>::type>::type>::type { return m_left; }
 
             // expression right hand side
             auto re()       -> typename std::add_lvalue_reference<                        RightExpr>       ::type { return m_right; }
-            auto re() const -> typename std::add_lvalue_reference<typename std::add_const<RightExpr>::type>::type { return m_right; }
+            auto re() const -> typename std::add_lvalue_reference<typename std::add_const<typename std::remove_reference<RightExpr>::type>::type>::type { return m_right; }
 
             // [] overload to get expression at a specific index
-            auto operator [](std::size_t index) const -> decltype(BinaryOp::apply(this->le()[index], this->re()[index])) {
-                return BinaryOp::apply(le()[index], re()[index]);
+            LAZY_VECTOR_INLINE auto operator [](std::size_t index) const -> decltype(BinaryOp::apply(Operands::at(this->le(), index), Operands::at(this->re(), index))) {
+                return BinaryOp::apply(Operands::at(le(), index), Operands::at(re(), index));
+            }
+
+            // expression length (the left hand side of an expression is always a vector or an expression)
+            std::size_t size() const {
+                return m_left.size();
             }
     };
 
+
+
     /**
-    * binary operations
+    * \brief a scalar broadcasted over all positions of an expression (i.e. - 'a > Lazy::scalar(0.5f)')
+    *
+    * @param {T, in} scalar type
     **/
-    namespace BinaryOperations {
+    template<typename T> class Scalar {
+        // properties
+        private:
+            const T m_value;
 
-        // numerical/bit operator overloading
-#define CREATE_BINARY_OPERATION(xi_name, xi_operator, xi_assign_operator)                               \
-    template<typename T> struct xi_name {                                                               \
-        static T apply(const T& a, const T& b) { return a xi_operator b; }                              \
-        static T apply(T&& a,      const T& b) { a xi_assign_operator b; return std::move(a); }         \
-        static T apply(const T& a, T&& b)      { b xi_assign_operator a; return std::move(b); }         \
-        static T apply(T&& a,      T&& b)      { a xi_assign_operator b; return std::move(a); }         \
-    }
+        // types
+        public:
+            using value_type = T;
 
-        CREATE_BINARY_OPERATION(ADD, +, +=);
-        CREATE_BINARY_OPERATION(SUB, -, -=);
-        CREATE_BINARY_OPERATION(MUL, *, *=);
-        CREATE_BINARY_OPERATION(DIV, / , /=);
-        CREATE_BINARY_OPERATION(LOR, | , |=);
-        CREATE_BINARY_OPERATION(LAND, &, &=);
-        CREATE_BINARY_OPERATION(LXOR, ^, ^=);
-        CREATE_BINARY_OPERATION(SHL, << , <<=);
-        CREATE_BINARY_OPERATION(SHR, >> , >>=);
-#undef CREATE_BINARY_OPERATION
+        // constructors
+        public:
+            explicit Scalar(const T& xi_value) : m_value(xi_value) {}
 
-        // relation/logical operator overloading
-#define CREATE_BINARY_OPERATION(xi_name, xi_operator)                               \
-    template<typename T> struct xi_name {                                           \
-        static T apply(const T& a, const T& b) { return a xi_operator b; }          \
-        static T apply(T&& a,      const T& b) { return a xi_operator b; }          \
-        static T apply(const T& a, T&& b)      { return a xi_operator b; }          \
-        static T apply(T&& a,      T&& b)      { return a xi_operator b; }          \
+        // getters
+        public:
+            const T& value() const noexcept { return m_value; }
+            LAZY_VECTOR_INLINE const T& operator [](std::size_t) const noexcept { return m_value; }
+    };
+
+    // construct a scalar expression operand
+    template<typename T> Scalar<T> scalar(const T& xi_value) {
+        return Scalar<T>(xi_value);
     }
 
-        CREATE_BINARY_OPERATION(AND, &&);
-        CREATE_BINARY_OPERATION(OR, ||);
-        CREATE_BINARY_OPERATION(EQ, ==);
-        CREATE_BINARY_OPERATION(NEQ, !=);
-        CREATE_BINARY_OPERATION(LT, <);
-        CREATE_BINARY_OPERATION(LE, <=);
-        CREATE_BINARY_OPERATION(GT, >);
-        CREATE_BINARY_OPERATION(GE, >=);
-#undef CREATE_BINARY_OPERATION
+    /**
+    * \brief per block minimum/maximum summary of a vector, used to skip (or fully accept) blocks when evaluating predicates.
+    *        the summary is rebuilt lazily, i.e. - vector modifications only mark it as dirty.
+    *
+    * @param {T, in} vector underlying type (should be ordered by '<')
+    **/
+    template<typename T> class ZoneMap {
+        // properties
+        private:
+            std::size_t m_blockSize;    // amount of elements summarized by each block
+            std::size_t m_size{};       // amount of elements summarized
+            std::vector<T> m_min;       // blocks minimal value
+            std::vector<T> m_max;       // blocks maximal value
+            bool m_dirty{ true };       // summary does not reflect vector content
+
+        // constructors
+        public:
+            explicit ZoneMap(const std::size_t xi_blockSize) : m_blockSize(xi_blockSize > 0 ? xi_blockSize : 1) {}
+
+        // modifiers
+        public:
+
+            // mark summary as out of date
+            void invalidate() noexcept { m_dirty = true; }
+
+            // rebuild summary from vector content
+            void rebuild(const T* xi_data, const std::size_t xi_size) {
+                const std::size_t blocks{ (xi_size + m_blockSize - 1) / m_blockSize };
+                m_size = xi_size;
+                m_min.resize(blocks);
+                m_max.resize(blocks);
+
+                for (std::size_t b{}; b < blocks; ++b) {
+                    const std::size_t first{ b * m_blockSize },
+                                      last{ (first + m_blockSize < xi_size) ? first + m_blockSize : xi_size };
+                    T lo{ xi_data[first] },
+                      hi{ xi_data[first] };
+                    for (std::size_t i{ first + 1 }; i < last; ++i) {
+                        if (xi_data[i] < lo) lo = xi_data[i];
+                        if (hi < xi_data[i]) hi = xi_data[i];
+                    }
+                    m_min[b] = lo;
+                    m_max[b] = hi;
+                }
+
+                m_dirty = false;
+            }
 
+        // queries
+        public:
+            bool dirty() const noexcept { return m_dirty; }
+            std::size_t block_size() const noexcept { return m_blockSize; }
+            std::size_t blocks() const noexcept { return m_min.size(); }
+            const T& min(const std::size_t xi_block) const { return m_min[xi_block]; }
+            const T& max(const std::size_t xi_block) const { return m_max[xi_block]; }
+
+            /**
+            * \brief conservative minimum/maximum over a range of positions (union of all blocks overlapping the range)
+            *
+            * @param {size_t, in}  range first position
+            * @param {size_t, in}  range last position (not included, should be larger than first)
+            * @param {T,      out} range minimum
+            * @param {T,      out} range maximum
+            **/
+            void bounds(const std::size_t xi_first, const std::size_t xi_last, T& xo_min, T& xo_max) const {
+                assert(!m_dirty && (xi_first < xi_last) && (xi_last <= m_size));
+
+                const std::size_t first{ xi_first / m_blockSize },
+                                  last{ (xi_last - 1) / m_blockSize };
+                xo_min = m_min[first];
+                xo_max = m_max[first];
+                for (std::size_t b{ first + 1 }; b <= last; ++b) {
+                    if (m_min[b] < xo_min) xo_min = m_min[b];
+                    if (xo_max < m_max[b]) xo_max = m_max[b];
+                }
+            }
     };
 
-    
     /**
-    * \brief lazy element-wise evaluated vector
-    * 
-    * @param {T, in} vector underlying type
+    * \brief a collection of modified position ranges ([first, last) pairs), used to re-evaluate only modified parts of derived vectors.
+    *        consecutive modifications of adjacent/overlapping positions are coalesced as they are marked. marking never throws -
+    *        if recording a range fails to allocate, all ranges are collapsed into a single one.
     **/
-    template<typename T> class Vector {
-        // vector maximal possible size (seems like a reasonable number...)
-        const std::size_t MaximumPossibleSize{ 1'000'000'000 };
+    class DirtyRanges {
+        // above this amount of recorded ranges, ranges are merged (and if still too many, collapsed into a single range)
+        static constexpr std::size_t MaximalRanges{ 4096 };
+
+        // types
+        public:
+            using Range = std::pair<std::size_t, std::size_t>;
 
         // properties
         private:
-            std::size_t m_reservedSize{ 4 };    // vector reserved size
-            std::size_t m_size{ 0 };            // vector size
-            T *m_data;                          // data holder
+            std::vector<Range> m_ranges;
 
         // internal methods
         private:
 
-            // reallocate vector (used when increasing vector size beyond its current size)
-            inline void reallocate() {
-                T *temp = new T[m_reservedSize];
-                memcpy(temp, m_data, m_size * sizeof(T));
-                delete[] m_data;
-                m_data = temp;
+            // replace all ranges (and a given one) by a single range covering them (capacity is kept, so this does not allocate)
+            void collapse(const std::size_t xi_first, const std::size_t xi_last) noexcept {
+                Range all{ xi_first, xi_last };
+                for (const Range& range : m_ranges) {
+                    all.first = std::min(all.first, range.first);
+                    all.second = std::max(all.second, range.second);
+                }
+                m_ranges.clear();
+                m_ranges.push_back(all);
             }
 
-        // types
-        public:
-            using iterator = T*;
-            using const_iterator = const T*;
-            using reverse_iterator = std::reverse_iterator<iterator>;
-            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
-            using difference_type = ptrdiff_t;
+            // record a range which is not coalesced with the last one (kept out of line, so that marking inlines into element loops)
+            LAZY_VECTOR_NOINLINE void append(const std::size_t xi_first, const std::size_t xi_last) noexcept {
+                try {
+                    m_ranges.emplace_back(xi_first, xi_last);
+                }
+                catch (...) {
+                    collapse(xi_first, xi_last);
+                    return;
+                }
+                if (m_ranges.size() > MaximalRanges) {
+                    merge();
+                    if (m_ranges.size() > MaximalRanges / 2) {
+                        collapse(xi_first, xi_last);
+                    }
+                }
+            }
+
+            // sort and merge overlapping/adjacent ranges
+            void merge() noexcept {
+                if (m_ranges.size() < 2) return;
+
+                std::sort(m_ranges.begin(), m_ranges.end());
+                std::size_t last{};
+                for (std::size_t i{ 1 }; i < m_ranges.size(); ++i) {
+                    if (m_ranges[i].first <= m_ranges[last].second) {
+                        m_ranges[last].second = std::max(m_ranges[last].second, m_ranges[i].second);
+                    }
+                    else {
+                        m_ranges[++last] = m_ranges[i];
+                    }
+                }
+                m_ranges.resize(last + 1);
+            }
 
         // constructors
         public:
 
-            // empty constructor
-            Vector() noexcept {
-                m_data = new T[m_reservedSize];
+            // (room for a range is reserved up front, so that a range can always be recorded without allocation)
+            DirtyRanges() {
+                m_ranges.reserve(16);
             }
 
-            // construct a vector by its size
-            explicit constexpr Vector(const std::size_t xi_size) {
-                // new size's
-                m_reservedSize = 2 * xi_size;
-                m_size = xi_size;
+        // modifiers
+        public:
 
-                // allocate and fill data container
-                m_data = new T[m_reservedSize];
-                for (std::size_t i{}; i < xi_size; ++i) {
-                    m_data[i] = T{};
+            // mark positions [first, last) as modified
+            void mark(const std::size_t xi_first, const std::size_t xi_last) noexcept {
+                if (xi_first >= xi_last) return;
+
+                if (!m_ranges.empty() && (xi_first <= m_ranges.back().second) && (xi_last >= m_ranges.back().first)) {
+                    m_ranges.back().first = std::min(m_ranges.back().first, xi_first);
+                    m_ranges.back().second = std::max(m_ranges.back().second, xi_last);
+                    return;
                 }
-            }
 
-            // construct a vector by its size and initial value
-            explicit constexpr Vector(const std::size_t xi_size, const T& xi_value) {
-                // new size's
-                m_reservedSize = 2 * xi_size;
-                m_size = xi_size;
+                append(xi_first, xi_last);
+            }
 
-                // allocate and fill data container
-                m_data = new T[m_reservedSize];
-                for (std::size_t i{}; i < xi_size; ++i) {
-                    m_data[i] = xi_value;
+            void clear() noexcept { m_ranges.clear(); }
+
+            /**
+            * \brief return all modified ranges (sorted, merged and clipped to a given length) and clear them
+            *
+            * @param {size_t, in}  length to which ranges are clipped
+            * @param {vector, out} modified ranges
+            **/
+            std::vector<Range> take(const std::size_t xi_length) {
+                merge();
+
+                std::vector<Range> ranges;
+                ranges.reserve(m_ranges.size());
+                for (const Range& range : m_ranges) {
+                    if (range.first >= xi_length) break;
+                    ranges.emplace_back(range.first, std::min(range.second, xi_length));
                 }
+
+                m_ranges.clear();
+                return ranges;
             }
 
-            // construct a vector by iterators
-            explicit constexpr Vector(T* xi_first, T* xi_last) {
-                const std::size_t len{ xi_last - xi_first };
+        // queries
+        public:
+            bool empty() const noexcept { return m_ranges.empty(); }
+            const std::vector<Range>& ranges() const noexcept { return m_ranges; }
+    };
 
-                // new size's
-                m_reservedSize = 2 * len;
-                m_size = len;
+    // forward declaration
+    template<typename T> class Vector;
 
-                // allocate and fill data container
-                m_data = new T[m_reservedSize];
-                for (std::size_t i{}; i < len; ++i, ++xi_first) {
-                    m_data[i] = *xi_first;
+    /**
+    * expression introspection
+    **/
+    namespace ExpressionTraits {
+
+        /**
+        * \brief expression tree shape
+        *
+        * @param {size_t, out} leaves     - amount of operands (vectors, scalars and opaque operands)
+        * @param {size_t, out} streams    - amount of vector operands (memory streams read by the expression)
+        * @param {size_t, out} operations - amount of binary operations
+        * @param {size_t, out} depth      - tree depth (a lone operand has depth 0)
+        * @param {size_t, out} bytes      - bytes read from vector operands per position
+        **/
+        template<typename Expression, typename = void> struct ElementSize : std::integral_constant<std::size_t, 0> {};
+        template<typename Expression> struct ElementSize<Expression, std::void_t<typename Expression::value_type>> : std::integral_constant<std::size_t, sizeof(typename Expression::value_type)> {};
+
+        template<typename Expression> struct Tree {
+            static constexpr std::size_t leaves{ 1 };
+            static constexpr std::size_t streams{ 1 };
+            static constexpr std::size_t operations{ 0 };
+            static constexpr std::size_t depth{ 0 };
+            static constexpr std::size_t bytes{ ElementSize<Expression>::value };
+        };
+
+        template<typename T> struct Tree<Scalar<T>> {
+            static constexpr std::size_t leaves{ 1 };
+            static constexpr std::size_t streams{ 0 };
+            static constexpr std::size_t operations{ 0 };
+            static constexpr std::size_t depth{ 0 };
+            static constexpr std::size_t bytes{ 0 };
+        };
+
+        template<typename L, typename Op, typename R> struct Tree<BinaryExpression<L, Op, R>> {
+            using Left = Tree<typename std::decay<L>::type>;
+            using Right = Tree<typename std::decay<R>::type>;
+            static constexpr std::size_t leaves{ Left::leaves + Right::leaves };
+            static constexpr std::size_t streams{ Left::streams + Right::streams };
+            static constexpr std::size_t operations{ 1 + Left::operations + Right::operations };
+            static constexpr std::size_t depth{ 1 + ((Left::depth > Right::depth) ? Left::depth : Right::depth) };
+            static constexpr std::size_t bytes{ Left::bytes + Right::bytes };
+        };
+
+        // amount of binary operations of each kind (BinaryOperations::kind) in an expression
+        template<typename Expression> struct Operators {
+            static constexpr std::array<std::size_t, BinaryOperations::Kinds> counts() { return {}; }
+        };
+
+        template<typename L, typename Op, typename R> struct Operators<BinaryExpression<L, Op, R>> {
+            static constexpr std::array<std::size_t, BinaryOperations::Kinds> counts() {
+                std::array<std::size_t, BinaryOperations::Kinds> out{ Operators<typename std::decay<L>::type>::counts() };
+                const std::array<std::size_t, BinaryOperations::Kinds> right{ Operators<typename std::decay<R>::type>::counts() };
+                for (std::size_t i{}; i < BinaryOperations::Kinds; ++i) {
+                    out[i] += right[i];
                 }
+                ++out[Op::kind];
+                return out;
+            }
+        };
+
+        // are all operands known (vectors and scalars)?
+        template<typename Expression> struct Known : std::false_type {};
+        template<typename T> struct Known<Vector<T>> : std::true_type {};
+        template<typename T> struct Known<Scalar<T>> : std::true_type {};
+        template<typename L, typename Op, typename R> struct Known<BinaryExpression<L, Op, R>> {
+            static constexpr bool value{ Known<typename std::decay<L>::type>::value && Known<typename std::decay<R>::type>::value };
+        };
+
+        // is an operand a binary expression?
+        template<typename Expression> struct IsExpression : std::false_type {};
+        template<typename L, typename Op, typename R> struct IsExpression<BinaryExpression<L, Op, R>> : std::true_type {};
+
+        // do all expression nodes evaluate to a given type?
+        template<typename T, typename Expression> struct Homogeneous : std::true_type {};
+        template<typename T, typename L, typename Op, typename R> struct Homogeneous<T, BinaryExpression<L, Op, R>> {
+            static constexpr bool value{ std::is_same<typename BinaryExpression<L, Op, R>::value_type, T>::value &&
+                                         Homogeneous<T, typename std::decay<L>::type>::value &&
+                                         Homogeneous<T, typename std::decay<R>::type>::value };
+        };
+
+        /**
+        * \brief collect the addresses of all vectors an expression reads from
+        *
+        * @param {Expression, in} expression
+        * @param {vector,    out} leaf vectors addresses
+        * @param {bool,      out} true if all operands are known (vectors, scalars or expressions of them),
+        *                         i.e. - expression at position i depends only on position i of its leaves
+        **/
+        template<typename Expression> struct Leaves {
+            static bool collect(const Expression&, std::vector<const void*>&) { return false; }
+            template<typename Function> static void visit(const Expression&, Function&) {}
+        };
+
+        template<typename T> struct Leaves<Vector<T>> {
+            static bool collect(const Vector<T>& xi_vector, std::vector<const void*>& xo_leaves) {
+                xo_leaves.push_back(&xi_vector);
+                return true;
             }
+            template<typename Function> static void visit(const Vector<T>& xi_vector, Function& xi_function) { xi_function(xi_vector); }
+        };
+
+        template<typename T> struct Leaves<Scalar<T>> {
+            static bool collect(const Scalar<T>&, std::vector<const void*>&) { return true; }
+            template<typename Function> static void visit(const Scalar<T>&, Function&) {}
+        };
+
+        template<typename L, typename Op, typename R> struct Leaves<BinaryExpression<L, Op, R>> {
+            static bool collect(const BinaryExpression<L, Op, R>& xi_expression, std::vector<const void*>& xo_leaves) {
+                const bool left{ Leaves<typename std::decay<L>::type>::collect(xi_expression.le(), xo_leaves) },
+                           right{ Leaves<typename std::decay<R>::type>::collect(xi_expression.re(), xo_leaves) };
+                return left && right;
+            }
+            template<typename Function> static void visit(const BinaryExpression<L, Op, R>& xi_expression, Function& xi_function) {
+                Leaves<typename std::decay<L>::type>::visit(xi_expression.le(), xi_function);
+                Leaves<typename std::decay<R>::type>::visit(xi_expression.re(), xi_function);
+            }
+        };
 
-            // construct a vector from initializer list
-            explicit constexpr Vector(std::initializer_list<T> xi_list) {
-                // new size's
-                m_reservedSize = 2 * xi_list.size();
-                m_size = xi_list.size();
+        // binary operation of an expression
+        template<typename Expression> struct Operation;
+        template<typename L, typename Op, typename R> struct Operation<BinaryExpression<L, Op, R>> {
+            using type = Op;
+        };
 
-                // allocate and fill data container
-                m_data = new T[m_reservedSize];
-                for (auto &item : xi_list) {
-                    m_data[m_size++] = item;
-                }
-            }
+        template<typename Expression> bool collect_leaves(const Expression& xi_expression, std::vector<const void*>& xo_leaves) {
+            return Leaves<typename std::decay<Expression>::type>::collect(xi_expression, xo_leaves);
+        }
 
-            // copy constructor
-            Vector(const Vector& xi_other) {
-                // new size's
-                m_reservedSize = xi_other.m_reservedSize;
-                m_size = xi_other.m_size;
+        // invoke a function with every vector an expression reads from
+        template<typename Expression, typename Function> void for_each_leaf(const Expression& xi_expression, Function&& xi_function) {
+            Leaves<typename std::decay<Expression>::type>::visit(xi_expression, xi_function);
+        }
 
-                // allocate and fill data container
-                m_data = new T[m_reservedSize];
-                for (std::size_t i{}; i < xi_other.m_size; ++i) {
-                    m_data[i] = xi_other.m_data[i];
-                }
+        /**
+        * \brief a compact expression name - operators and operand kinds, i.e. - '((vector + vector) * scalar)'
+        **/
+        template<typename Expression> struct Name {
+            static void append(std::string& xo_name) { xo_name += "operand"; }
+        };
+
+        template<typename T> struct Name<Vector<T>> {
+            static void append(std::string& xo_name) { xo_name += "vector"; }
+        };
+
+        template<typename T> struct Name<Scalar<T>> {
+            static void append(std::string& xo_name) { xo_name += "scalar"; }
+        };
+
+        template<typename L, typename Op, typename R> struct Name<BinaryExpression<L, Op, R>> {
+            static void append(std::string& xo_name) {
+                xo_name += '(';
+                Name<typename std::decay<L>::type>::append(xo_name);
+                xo_name += ' ';
+                xo_name += Op::symbol;
+                xo_name += ' ';
+                Name<typename std::decay<R>::type>::append(xo_name);
+                xo_name += ')';
             }
+        };
 
-            // move constructor
-            Vector(Vector&& xi_other) noexcept {
-                // new size's
-                m_reservedSize = xi_other.m_reservedSize;
-                m_size = xi_other.m_size;
+        template<typename Expression> std::string name() {
+            std::string out;
+            Name<typename std::decay<Expression>::type>::append(out);
+            return out;
+        }
 
-                // allocate and fill data container
-                m_data = new T[m_reservedSize];
-                for (std::size_t i{}; i < xi_other.m_size; ++i) {
-                    m_data[i] = std::move(xi_other.m_data[i]);
-                }
+        /**
+        * \brief per position cost of assigning an expression into a destination of type T
+        *
+        * @param {size_t, out} bytesRead    - bytes read from vector operands
+        * @param {size_t, out} bytesWritten - bytes written to destination
+        * @param {size_t, out} divisions    - amount of divisions
+        * @param {size_t, out} flops        - arithmetic operations (+, -, *, /) on floating point values (zero for other types)
+        * @param {size_t, out} work         - estimated work, in units of a single cheap operation
+        *                                     (operations, divisions weigh four, and one unit per memory stream)
+        * @param {bool,   out} vectorizable - arithmetic destination, homogeneous expression and known operands only
+        **/
+        template<typename T, typename Expression> struct Cost {
+            using Shape = Tree<typename std::decay<Expression>::type>;
+            static constexpr std::array<std::size_t, BinaryOperations::Kinds> operators{ Operators<typename std::decay<Expression>::type>::counts() };
+
+            static constexpr std::size_t leaves{ Shape::leaves };
+            static constexpr std::size_t streams{ Shape::streams };
+            static constexpr std::size_t operations{ Shape::operations };
+            static constexpr std::size_t depth{ Shape::depth };
+            static constexpr std::size_t bytesRead{ Shape::bytes };
+            static constexpr std::size_t bytesWritten{ sizeof(T) };
+            static constexpr std::size_t divisions{ operators[3] };
+            static constexpr std::size_t arithmetic{ operators[0] + operators[1] + operators[2] + operators[3] };
+            static constexpr std::size_t flops{ std::is_floating_point<T>::value ? arithmetic : 0 };
+            static constexpr std::size_t work{ operations + 3 * divisions + streams + 1 };
+            static constexpr bool vectorizable{ std::is_arithmetic<T>::value && Homogeneous<T, typename std::decay<Expression>::type>::value &&
+                                                Known<typename std::decay<Expression>::type>::value };
+
+            // floating point operations per byte moved
+            static constexpr double intensity() noexcept {
+                return static_cast<double>(flops) / static_cast<double>(bytesRead + bytesWritten);
+            }
+        };
+
+        /**
+        * \brief expression tree printer, i.e. - for 'a * b + s':
+        *        +
+        *        |- *
+        *        |  |- vector (4 bytes)
+        *        |  `- vector (4 bytes)
+        *        `- scalar
+        **/
+        template<typename Expression> struct Printer {
+            static void print(std::string& xo_out, const std::string&) {
+                xo_out += "operand\n";
+            }
+        };
 
-                xi_other.m_data = nullptr;
-                xi_other.m_size = 0;
+        template<typename T> struct Printer<Vector<T>> {
+            static void print(std::string& xo_out, const std::string&) {
+                xo_out += "vector (" + std::to_string(sizeof(T)) + " bytes)\n";
             }
+        };
 
-            // destructor
-            ~Vector() {
-                delete[] m_data;
+        template<typename T> struct Printer<Scalar<T>> {
+            static void print(std::string& xo_out, const std::string&) {
+                xo_out += "scalar\n";
+            }
+        };
+
+        template<typename L, typename Op, typename R> struct Printer<BinaryExpression<L, Op, R>> {
+            static void print(std::string& xo_out, const std::string& xi_indent) {
+                xo_out += Op::symbol;
+                xo_out += '\n';
+                xo_out += xi_indent + "|- ";
+                Printer<typename std::decay<L>::type>::print(xo_out, xi_indent + "|  ");
+                xo_out += xi_indent + "`- ";
+                Printer<typename std::decay<R>::type>::print(xo_out, xi_indent + "   ");
             }
+        };
 
-            // copy assignment
-            Vector& operator = (const Vector& xi_other) {
-                // allocate
-                m_size = xi_other.m_size;
-                if (m_reservedSize < xi_other.m_size) {
-                    m_reservedSize = 2 * xi_other.m_size;
-                    reallocate();
-                }
+        template<typename Expression> std::string tree() {
+            std::string out;
+            Printer<typename std::decay<Expression>::type>::print(out, "");
+            return out;
+        }
 
-                // fill data container
-                for (std::size_t i{}; i < xi_other.m_size; ++i) {
-                    m_data[i] = xi_other.m_data[i];
-                }
+        // expression tree followed by its cost model (assigned into a destination of type T)
+        template<typename T, typename Expression> std::string describe() {
+            using C = Cost<T, Expression>;
+            std::string out{ tree<Expression>() };
+            out += "leaves " + std::to_string(C::leaves) + ", streams " + std::to_string(C::streams) + ", depth " + std::to_string(C::depth) +
+                   ", operations " + std::to_string(C::operations) + " (";
+            bool first{ true };
+            for (std::size_t i{}; i < BinaryOperations::Kinds; ++i) {
+                if (C::operators[i] == 0) continue;
+                out += (first ? "" : ", ") + std::to_string(C::operators[i]) + " x '" + BinaryOperations::symbol(i) + "'";
+                first = false;
             }
+            char line[160];
+            std::snprintf(line, sizeof(line), ")\nbytes read %zu, written %zu, flops %zu, intensity %.3f flop/byte, work %zu, %s\n",
+                          C::bytesRead, C::bytesWritten, C::flops, C::intensity(), C::work, C::vectorizable ? "vectorizable" : "scalar");
+            return out + line;
+        }
 
-            // move assignment
-            Vector& operator = (Vector&& xi_other) {
-                // allocate
-                m_size = xi_other.m_size;
-                if (m_reservedSize < xi_other.m_size) {
-                    m_reservedSize = 2 * xi_other.m_size;
-                    reallocate();
-                }
+        // describe an expression object (type deduced)
+        template<typename Expression> std::string describe(const Expression&) {
+            using E = typename std::decay<Expression>::type;
+            return describe<typename std::decay<decltype(std::declval<const E&>()[0])>::type, E>();
+        }
+    };
 
-                // fill data container
-                for (std::size_t i{}; i < xi_other.m_size; ++i) {
-                    m_data[i] = std::move(xi_other.m_data[i]);
+    /**
+    * evaluation statistics - compiled in only when LAZY_VECTOR_STATISTICS is defined (otherwise all recording functions are empty
+    * and snapshot() returns zeros). counters are process wide, updated atomically and can be read at any time.
+    **/
+    namespace Statistics {
+
+#if defined(LAZY_VECTOR_STATISTICS)
+        constexpr bool Enabled{ true };
+#else
+        constexpr bool Enabled{ false };
+#endif
+
+        // counters of a single assignment operation kind (AssignOperations::kind)
+        struct Operation {
+            std::size_t evaluations{};      // evaluator invocations (deferred and materialized assignments are evaluated range by range)
+            std::size_t elements{};         // elements assigned
+            std::size_t bytes{};            // bytes read (vector operands and compound assigned destination) and written
+            std::size_t nanoseconds{};      // time spent evaluating
+        };
+
+        // a copy of all counters
+        struct Snapshot {
+            Operation operations[AssignOperations::Kinds];
+            std::size_t reallocations{};    // vector buffer reallocations
+            std::size_t growthBytes{};      // bytes moved from old buffers during reallocation
+            std::size_t peakCapacity{};     // largest vector buffer allocated (bytes)
+
+            // all operations counters summed
+            Operation total() const noexcept {
+                Operation sum;
+                for (const Operation& operation : operations) {
+                    sum.evaluations += operation.evaluations;
+                    sum.elements += operation.elements;
+                    sum.bytes += operation.bytes;
+                    sum.nanoseconds += operation.nanoseconds;
                 }
+                return sum;
+            }
+        };
+
+#if defined(LAZY_VECTOR_STATISTICS)
+        // counters storage
+        struct Counters {
+            struct Atomic {
+                std::atomic<std::size_t> evaluations{};
+                std::atomic<std::size_t> elements{};
+                std::atomic<std::size_t> bytes{};
+                std::atomic<std::size_t> nanoseconds{};
+            };
+
+            Atomic operations[AssignOperations::Kinds];
+            std::atomic<std::size_t> reallocations{};
+            std::atomic<std::size_t> growthBytes{};
+            std::atomic<std::size_t> peakCapacity{};
+        };
+
+        inline Counters& counters() noexcept {
+            static Counters instance;
+            return instance;
+        }
+#endif
+
+        // record an evaluation of an expression over a given amount of elements
+        template<typename Assign, typename T, typename Expression> void evaluation(const std::size_t xi_elements, const std::size_t xi_nanoseconds) noexcept {
+#if defined(LAZY_VECTOR_STATISTICS)
+            constexpr std::size_t streams{ ExpressionTraits::Tree<typename std::decay<Expression>::type>::streams +
+                                           (std::is_same<Assign, AssignOperations::ASSIGN>::value ? 1 : 2) };
+            Counters::Atomic& operation{ counters().operations[Assign::kind] };
+            operation.evaluations.fetch_add(1, std::memory_order_relaxed);
+            operation.elements.fetch_add(xi_elements, std::memory_order_relaxed);
+            operation.bytes.fetch_add(xi_elements * streams * sizeof(T), std::memory_order_relaxed);
+            operation.nanoseconds.fetch_add(xi_nanoseconds, std::memory_order_relaxed);
+#else
+            (void)xi_elements;
+            (void)xi_nanoseconds;
+#endif
+        }
 
-                xi_other.m_data = nullptr;
-                xi_other.m_size = 0;
+        // record a buffer allocation of a given amount of bytes
+        inline void allocation(const std::size_t xi_bytes) noexcept {
+#if defined(LAZY_VECTOR_STATISTICS)
+            std::atomic<std::size_t>& peak{ counters().peakCapacity };
+            std::size_t current{ peak.load(std::memory_order_relaxed) };
+            while ((current < xi_bytes) && !peak.compare_exchange_weak(current, xi_bytes, std::memory_order_relaxed)) {}
+#else
+            (void)xi_bytes;
+#endif
+        }
+
+        // record a reallocation which moved a given amount of bytes
+        inline void reallocation(const std::size_t xi_bytes) noexcept {
+#if defined(LAZY_VECTOR_STATISTICS)
+            counters().reallocations.fetch_add(1, std::memory_order_relaxed);
+            counters().growthBytes.fetch_add(xi_bytes, std::memory_order_relaxed);
+#else
+            (void)xi_bytes;
+#endif
+        }
+
+        // read all counters
+        inline Snapshot snapshot() noexcept {
+            Snapshot out;
+#if defined(LAZY_VECTOR_STATISTICS)
+            Counters& current{ counters() };
+            for (std::size_t i{}; i < AssignOperations::Kinds; ++i) {
+                out.operations[i].evaluations = current.operations[i].evaluations.load(std::memory_order_relaxed);
+                out.operations[i].elements = current.operations[i].elements.load(std::memory_order_relaxed);
+                out.operations[i].bytes = current.operations[i].bytes.load(std::memory_order_relaxed);
+                out.operations[i].nanoseconds = current.operations[i].nanoseconds.load(std::memory_order_relaxed);
             }
+            out.reallocations = current.reallocations.load(std::memory_order_relaxed);
+            out.growthBytes = current.growthBytes.load(std::memory_order_relaxed);
+            out.peakCapacity = current.peakCapacity.load(std::memory_order_relaxed);
+#endif
+            return out;
+        }
 
-            // construct from a binary expression
-            template<typename LE, typename Op, typename RE> Vector(BinaryExpression<LE, Op, RE>&& xi_expression) {
-                for (std::size_t i{}; i < m_size; ++i) {
-                    this->operator[](i) = xi_expression[i];
-                }
+        // zero all counters
+        inline void reset() noexcept {
+#if defined(LAZY_VECTOR_STATISTICS)
+            Counters& current{ counters() };
+            for (Counters::Atomic& operation : current.operations) {
+                operation.evaluations.store(0, std::memory_order_relaxed);
+                operation.elements.store(0, std::memory_order_relaxed);
+                operation.bytes.store(0, std::memory_order_relaxed);
+                operation.nanoseconds.store(0, std::memory_order_relaxed);
             }
+            current.reallocations.store(0, std::memory_order_relaxed);
+            current.growthBytes.store(0, std::memory_order_relaxed);
+            current.peakCapacity.store(0, std::memory_order_relaxed);
+#endif
+        }
+    };
 
-            // assign from a (right) expression
-            template<typename RightExpr> Vector& operator =(RightExpr&& xi_expression) {
-                for (std::size_t i{}; i < m_size; ++i) {
-                    this->operator[](i) = xi_expression[i];
-                }
-                return *this;
+    /**
+    * per call site profiling - compiled in only when LAZY_VECTOR_PROFILING is defined.
+    * every evaluation (assignments, compound assignments and reductions) records its duration and element count, keyed by
+    * call site, assignment operator and expression. reductions take their call site as a defaulted argument, operator evaluations
+    * are attributed to the innermost Profiling::Region of the evaluating thread (or to an unknown site outside of regions).
+    * results are available as a report sorted by total time, and as a Chrome trace (chrome://tracing, Perfetto).
+    **/
+    namespace Profiling {
+
+#if defined(LAZY_VECTOR_PROFILING)
+        constexpr bool Enabled{ true };
+#else
+        constexpr bool Enabled{ false };
+#endif
+
+        /**
+        * \brief a source location (std::source_location where available, compiler builtins otherwise)
+        **/
+        struct Site {
+            const char* file{ "unknown" };
+            const char* function{ "" };
+            std::size_t line{};
+
+#if defined(__cpp_lib_source_location)
+            static constexpr Site current(const std::source_location xi_location = std::source_location::current()) noexcept {
+                return { xi_location.file_name(), xi_location.function_name(), xi_location.line() };
             }
+#elif defined(__GNUC__) || defined(__clang__)
+            static constexpr Site current(const char* xi_file = __builtin_FILE(), const char* xi_function = __builtin_FUNCTION(),
+                                          const std::size_t xi_line = __builtin_LINE()) noexcept {
+                return { xi_file, xi_function, xi_line };
+            }
+#else
+            static constexpr Site current() noexcept { return {}; }
+#endif
+        };
+
+        /**
+        * \brief aggregated measurements of an expression evaluated at a call site
+        **/
+        struct Entry {
+            Site site;
+            std::string operation;          // assignment operator, 'reduce' or 'region'
+            std::string expression;         // expression name (region function name for regions)
+            std::size_t calls{};
+            std::size_t elements{};
+            std::size_t nanoseconds{};      // total time
+            std::size_t minimal{};          // shortest call (nanoseconds)
+            std::size_t maximal{};          // longest call (nanoseconds)
+        };
+
+#if defined(LAZY_VECTOR_PROFILING)
+        // amount of trace events kept (later events are only aggregated)
+        constexpr std::size_t MaximalEvents{ 1 << 20 };
+
+        using Clock = std::chrono::steady_clock;
+
+        // a single evaluation, for the trace
+        struct Event {
+            std::size_t entry;
+            std::size_t start;              // nanoseconds since profiling start
+            std::size_t duration;           // nanoseconds
+            std::size_t elements;
+            std::size_t thread;
+        };
+
+        struct State {
+            using Key = std::tuple<std::string_view, std::size_t, std::string_view, const void*>;   // file, line, operation, expression
+
+            std::mutex mutex;
+            Clock::time_point origin{ Clock::now() };
+            std::vector<Entry> entries;
+            std::map<Key, std::size_t> index;
+            std::vector<Event> events;
+        };
+
+        inline State& state() {
+            static State instance;
+            return instance;
+        }
 
-            // assign from initializer list
-            constexpr Vector& operator = (std::initializer_list<T> xi_list) {
-                // allocation               
-                if (m_reservedSize < xi_list.size()) {
-                    m_reservedSize = 2 * xi_list.size();
-                    reallocate();
-                }
+        // sequential id of the calling thread
+        inline std::size_t thread_id() noexcept {
+            static std::atomic<std::size_t> next{ 1 };
+            thread_local const std::size_t id{ next.fetch_add(1) };
+            return id;
+        }
 
-                // fill data container
-                m_size = 0;
-                for (auto& item : xi_list) {
-                    m_data[m_size++] = item;
-                }
-            }
-            // assigns new contents to the vector, given size & value
-            void assign(const std::size_t xi_count, const T& xi_value) {
-                // allocate
-                if (xi_count > m_reservedSize) {
-                    m_reservedSize = 2 * xi_count;
-                    reallocate();
-                }
-                m_size = xi_count;
+        // innermost region of the calling thread
+        inline const Site*& region_site() noexcept {
+            thread_local const Site* site{ nullptr };
+            return site;
+        }
 
-                // fill
-                for (std::size_t i{}; i < xi_count; ++i) {
-                    m_data[i] = xi_value;
-                }
+        /**
+        * \brief record a measurement
+        *
+        * @param {Site,       in} call site
+        * @param {string,     in} operation
+        * @param {void*,      in} expression identity (unique per expression type)
+        * @param {string,     in} expression name (only used the first time an expression is recorded at a site)
+        * @param {time_point, in} start time
+        * @param {time_point, in} end time
+        * @param {size_t,     in} amount of elements
+        **/
+        inline void record(const Site& xi_site, const char* xi_operation, const void* xi_identity, const std::string& xi_expression,
+                           const Clock::time_point xi_start, const Clock::time_point xi_end, const std::size_t xi_elements) {
+            const std::size_t duration{ static_cast<std::size_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(xi_end - xi_start).count()) };
+            State& current{ state() };
+            std::lock_guard<std::mutex> lock(current.mutex);
+
+            const State::Key key{ xi_site.file, xi_site.line, xi_operation, xi_identity };
+            auto found{ current.index.find(key) };
+            if (found == current.index.end()) {
+                Entry entry;
+                entry.site = xi_site;
+                entry.operation = xi_operation;
+                entry.expression = xi_expression;
+                entry.minimal = duration;
+                found = current.index.emplace(key, current.entries.size()).first;
+                current.entries.push_back(std::move(entry));
             }
 
-            // assigns new contents to the vector, given start/end iterators
-            void assign(const T* xi_first, const T* xi_last) {
-                // allocate
-                const std::size_t count{ xi_last - xi_first };
-                if (count > m_reservedSize) {
-                    m_reservedSize = count << 2;
-                    reallocate();
-                }
-                m_size = count;
+            Entry& entry{ current.entries[found->second] };
+            ++entry.calls;
+            entry.elements += xi_elements;
+            entry.nanoseconds += duration;
+            entry.minimal = std::min(entry.minimal, duration);
+            entry.maximal = std::max(entry.maximal, duration);
 
-                // fill
-                for (std::size_t i{}; i < count; ++i, ++xi_first) {
-                    m_data[i] = *xi_first;
-                }
+            if (current.events.size() < MaximalEvents) {
+                const auto start{ std::chrono::duration_cast<std::chrono::nanoseconds>(xi_start - current.origin).count() };
+                current.events.push_back({ found->second, static_cast<std::size_t>(std::max<decltype(start)>(start, 0)), duration, xi_elements, thread_id() });
             }
+        }
 
-            // assigns new contents to the vector, given initializer list
-            void assign(std::initializer_list<T> xi_list) {
-                // allocate
-                const std::size_t count{ xi_list.size() };
-                if (count > m_reservedSize) {
-                    m_reservedSize = count << 2;
-                    reallocate();
+        // record an evaluation of an expression type
+        template<typename Expression> void expression(const Site& xi_site, const char* xi_operation, const Clock::time_point xi_start,
+                                                       const Clock::time_point xi_end, const std::size_t xi_elements) {
+            static const std::string name{ ExpressionTraits::name<Expression>() };
+            record(xi_site, xi_operation, &name, name, xi_start, xi_end, xi_elements);
+        }
+
+        // site to which operator evaluations on the calling thread are attributed
+        inline Site attributed() noexcept {
+            const Site* site{ region_site() };
+            return (site != nullptr) ? *site : Site{};
+        }
+#endif
+
+        /**
+        * \brief a profiled scope - its duration is recorded, and evaluations within it (on the same thread) are attributed to its site
+        *        (i.e. - 'Lazy::Profiling::Region region;' at the top of a function attributes all its assignments to that function)
+        **/
+        class Region {
+#if defined(LAZY_VECTOR_PROFILING)
+            // properties
+            private:
+                Site m_site;
+                const Site* m_parent;
+                Clock::time_point m_start;
+
+            // constructors
+            public:
+                explicit Region(const Site xi_site = Site::current()) : m_site(xi_site), m_parent(region_site()), m_start(Clock::now()) {
+                    region_site() = &m_site;
                 }
 
-                // fill
-                std::size_t i{};
-                for (auto& item : xi_list) {
-                    m_data[i++] = item;
+                ~Region() {
+                    region_site() = m_parent;
+                    record(m_site, "region", nullptr, m_site.function, m_start, Clock::now(), 0);
                 }
+#else
+            public:
+                explicit Region(const Site = Site::current()) noexcept {}
+#endif
+
+                Region(const Region&) = delete;
+                Region& operator=(const Region&) = delete;
+        };
+
+        // all entries, sorted by total time (descending)
+        inline std::vector<Entry> report() {
+            std::vector<Entry> out;
+#if defined(LAZY_VECTOR_PROFILING)
+            {
+                State& current{ state() };
+                std::lock_guard<std::mutex> lock(current.mutex);
+                out = current.entries;
             }
+            std::sort(out.begin(), out.end(), [](const Entry& a, const Entry& b) { return a.nanoseconds > b.nanoseconds; });
+#endif
+            return out;
+        }
 
-        // iterators
-        public:
-            
-                  T* begin()        noexcept { return m_data; }
-            const T* cbegin() const noexcept { return m_data; }
+        // write the report as a table
+        inline void write_report(std::ostream& xo_stream) {
+            xo_stream << "total[ms]    calls     mean[us]    min[us]     max[us]     elements     ns/element  site / operation / expression\n";
+            for (const Entry& entry : report()) {
+                char line[160];
+                const double calls{ static_cast<double>(std::max<std::size_t>(entry.calls, 1)) };
+                std::snprintf(line, sizeof(line), "%-12.3f %-9zu %-11.3f %-11.3f %-11.3f %-12zu %-11.3f ",
+                              entry.nanoseconds * 1e-6, entry.calls, entry.nanoseconds * 1e-3 / calls, entry.minimal * 1e-3, entry.maximal * 1e-3,
+                              entry.elements, (entry.elements > 0) ? static_cast<double>(entry.nanoseconds) / static_cast<double>(entry.elements) : 0.0);
+                xo_stream << line << entry.site.file << ":" << entry.site.line << " " << entry.operation << " " << entry.expression << "\n";
+            }
+        }
 
-                  T* end()        noexcept { return m_data + m_size; }
-            const T* cend() const noexcept { return m_data + m_size; }
+        // write all recorded evaluations in Chrome trace event format
+        inline void write_trace(std::ostream& xo_stream) {
+#if defined(LAZY_VECTOR_PROFILING)
+            const auto escape = [](const std::string& xi_text) {
+                std::string out;
+                for (const char c : xi_text) {
+                    if ((c == '"') || (c == '\\')) out += '\\';
+                    out += c;
+                }
+                return out;
+            };
+
+            State& current{ state() };
+            std::lock_guard<std::mutex> lock(current.mutex);
+            xo_stream << "{\"traceEvents\": [";
+            for (std::size_t i{}; i < current.events.size(); ++i) {
+                const Event& event{ current.events[i] };
+                const Entry& entry{ current.entries[event.entry] };
+                char timing[96];
+                std::snprintf(timing, sizeof(timing), "\"ts\": %.3f, \"dur\": %.3f", event.start * 1e-3, event.duration * 1e-3);
+                xo_stream << ((i > 0) ? ",\n" : "\n")
+                          << "{\"name\": \"" << escape(entry.operation + " " + entry.expression) << "\", \"cat\": \"" << ((entry.operation == "region") ? "region" : "evaluation")
+                          << "\", \"ph\": \"X\", " << timing << ", \"pid\": 1, \"tid\": " << event.thread
+                          << ", \"args\": {\"site\": \"" << escape(std::string(entry.site.file) + ":" + std::to_string(entry.site.line))
+                          << "\", \"elements\": " << event.elements << "}}";
+            }
+            xo_stream << "\n], \"displayTimeUnit\": \"ns\"}\n";
+#else
+            xo_stream << "{\"traceEvents\": []}\n";
+#endif
+        }
 
-            reverse_iterator rbegin() noexcept { return reverse_iterator(m_data + m_size); }
-            const_reverse_iterator crbegin() const noexcept { return reverse_iterator(m_data + m_size); }
+        // discard all measurements
+        inline void reset() {
+#if defined(LAZY_VECTOR_PROFILING)
+            State& current{ state() };
+            std::lock_guard<std::mutex> lock(current.mutex);
+            current.entries.clear();
+            current.index.clear();
+            current.events.clear();
+            current.origin = Clock::now();
+#endif
+        }
+    };
 
-            reverse_iterator rend() noexcept { return reverse_iterator(m_data); }
-            const_reverse_iterator crend() const noexcept { return reverse_iterator(m_data); }
+    /**
+    * hardware performance counters (Linux perf_event_open) - compiled in only when LAZY_VECTOR_PERF_COUNTERS is defined.
+    * cycles, instructions, last level cache misses and data TLB misses are sampled around every evaluation (attributed to
+    * the expression type and assignment operator) and around user defined regions. counters are opened lazily per thread and
+    * only count the calling thread (chunks of a parallel evaluation executed by pool workers are not included).
+    * a counter which can not be opened (no PMU access, perf_event_paranoid, virtual machines) is reported as unavailable,
+    * and all others keep working; without counters nothing is recorded.
+    **/
+    namespace HardwareCounters {
 
-        // capacity queries/modifiers
-        public:
+#if defined(LAZY_VECTOR_PERF_COUNTERS) && defined(__linux__)
+        constexpr bool Enabled{ true };
+#else
+        constexpr bool Enabled{ false };
+#endif
 
-            // is vector empty?
-            constexpr bool empty() const noexcept {
-                return (m_size == 0);
-            }
+        // sampled counters
+        enum Counter : std::size_t { Cycles, Instructions, CacheMisses, TlbMisses, Counters };
 
-            // return vector size
-            constexpr std::size_t size() const noexcept {
-                return m_size;
-            }
+        // counter name
+        constexpr const char* name(const std::size_t xi_counter) noexcept {
+            constexpr const char* names[Counters]{ "cycles", "instructions", "llc-misses", "dtlb-misses" };
+            return (xi_counter < Counters) ? names[xi_counter] : "?";
+        }
 
-            // return vector maximum possible size
-            constexpr std::size_t maxPossibleSize() const noexcept {
-                return MaximumPossibleSize;
+        /**
+        * \brief counter values (scaled for multiplexing) - a counter is valid only if it could be opened
+        **/
+        struct Sample {
+            std::uint64_t values[Counters]{};
+            bool valid[Counters]{};
+
+            // counters difference (valid only where both are valid)
+            Sample operator -(const Sample& xi_other) const noexcept {
+                Sample out;
+                for (std::size_t i{}; i < Counters; ++i) {
+                    out.valid[i] = valid[i] && xi_other.valid[i];
+                    out.values[i] = out.valid[i] ? (values[i] - xi_other.values[i]) : 0;
+                }
+                return out;
             }
+        };
+
+        /**
+        * \brief aggregated counters of an expression (or region)
+        **/
+        struct Entry {
+            std::string operation;          // assignment operator or 'region'
+            std::string name;               // expression (or region) name
+            std::size_t calls{};
+            std::size_t elements{};
+            Sample totals;
+        };
+
+#if defined(LAZY_VECTOR_PERF_COUNTERS) && defined(__linux__)
+        /**
+        * \brief counters of the calling thread
+        **/
+        class ThreadCounters {
+            // properties
+            private:
+                int m_descriptors[Counters];
+
+            // internal methods
+            private:
+                static int open(const std::uint32_t xi_type, const std::uint64_t xi_config) noexcept {
+                    perf_event_attr attributes;
+                    std::memset(&attributes, 0, sizeof(attributes));
+                    attributes.size = sizeof(attributes);
+                    attributes.type = xi_type;
+                    attributes.config = xi_config;
+                    attributes.exclude_kernel = 1;
+                    attributes.exclude_hv = 1;
+                    attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+                    return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+                }
 
-            // return vector capacity
-            constexpr std::size_t capacity() const noexcept {
-                return m_reservedSize;
-            }
+            // constructors
+            public:
+                ThreadCounters() noexcept {
+                    constexpr std::uint64_t tlbMiss{ PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) };
+                    m_descriptors[Cycles] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+                    m_descriptors[Instructions] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+                    m_descriptors[CacheMisses] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+                    m_descriptors[TlbMisses] = open(PERF_TYPE_HW_CACHE, tlbMiss);
+                }
 
-            // resize vector to a given size
-            void resize(const std::size_t xi_size) {
-                if (xi_size > m_size) {
-                    // allocate
-                    if (xi_size > m_reservedSize) {
-                        m_reservedSize = xi_size;
-                        reallocate();
+                ~ThreadCounters() {
+                    for (const int descriptor : m_descriptors) {
+                        if (descriptor >= 0) close(descriptor);
                     }
                 }
-                else {
-                    // destroy excess elements
-                    if constexpr (!std::is_arithmetic<T>::value) {
-                        for (std::size_t i{ m_size }; i < xi_size; ++i) {
-                            m_data[i].~T();
-                        }
+
+                ThreadCounters(const ThreadCounters&) = delete;
+                ThreadCounters& operator=(const ThreadCounters&) = delete;
+
+            // queries
+            public:
+                Sample read() const noexcept {
+                    Sample out;
+                    for (std::size_t i{}; i < Counters; ++i) {
+                        std::uint64_t values[3]{};     // value, time enabled, time running
+                        if ((m_descriptors[i] < 0) || (::read(m_descriptors[i], values, sizeof(values)) != static_cast<ssize_t>(sizeof(values)))) continue;
+
+                        out.valid[i] = true;
+                        out.values[i] = ((values[2] > 0) && (values[2] < values[1])) ?
+                                        static_cast<std::uint64_t>(static_cast<double>(values[0]) * static_cast<double>(values[1]) / static_cast<double>(values[2])) :
+                                        values[0];
                     }
+                    return out;
                 }
+        };
 
-                m_size = xi_size;
-            }
+        inline const ThreadCounters& thread_counters() {
+            thread_local const ThreadCounters instance;
+            return instance;
+        }
 
-            // resize vector to a given size and fill it with a given value
-            void resize(const std::size_t xi_size, const T& xi_value) {
-                if (xi_size > m_size) {
-                    // allocate
-                    if (xi_size > m_reservedSize) {
-                        m_reservedSize = xi_size;
-                        reallocate();
-                    }
-                    for (std::size_t i{ m_size }; i < xi_size; ++i)
-                        m_data[i] = xi_value;
-                }
-                else {
-                    // destroy excess elements
-                    if constexpr (!std::is_arithmetic<T>::value) {
-                        for (std::size_t i{ m_size }; i < xi_size; ++i) {
-                            m_data[i].~T();
-                        }
-                    }
-                }
+        struct State {
+            std::mutex mutex;
+            std::vector<Entry> entries;
+            std::vector<std::pair<const void*, std::string>> keys;     // entry identity (expression type or region name) and operation
+        };
 
-                m_size = xi_size;
-            }
+        inline State& state() {
+            static State instance;
+            return instance;
+        }
 
-            // reserve a given size
-            void reserve(const std::size_t xi_size) {
-                // allocate
-                if (xi_size > m_reservedSize) {
-                    m_reservedSize = xi_size;
-                    reallocate();
-                }
+        inline void record(const void* xi_identity, const char* xi_operation, const std::string& xi_name, const Sample& xi_delta, const std::size_t xi_elements) {
+            bool any{ false };
+            for (const bool valid : xi_delta.valid) any = any || valid;
+            if (!any) return;
+
+            State& current{ state() };
+            std::lock_guard<std::mutex> lock(current.mutex);
+
+            std::size_t index{};
+            while ((index < current.keys.size()) && ((current.keys[index].first != xi_identity) || (current.keys[index].second != xi_operation))) ++index;
+            if (index == current.keys.size()) {
+                current.keys.emplace_back(xi_identity, xi_operation);
+                current.entries.push_back({ xi_operation, xi_name, 0, 0, {} });
             }
 
-            // shrink vector to its current size
-            void shrink_to_fit() {
-                m_reservedSize = m_size;
-                reallocate();
+            Entry& entry{ current.entries[index] };
+            ++entry.calls;
+            entry.elements += xi_elements;
+            for (std::size_t i{}; i < Counters; ++i) {
+                entry.totals.valid[i] = entry.totals.valid[i] || xi_delta.valid[i];
+                entry.totals.values[i] += xi_delta.values[i];
             }
+        }
+#endif
+
+        // current counters of the calling thread
+        inline Sample read() noexcept {
+#if defined(LAZY_VECTOR_PERF_COUNTERS) && defined(__linux__)
+            return thread_counters().read();
+#else
+            return {};
+#endif
+        }
 
-        // element wise access operations
-        public:
+        // which counters can be sampled (on the calling thread)?
+        inline Sample available() noexcept {
+            return read();
+        }
 
-            // [] operator overload
-                  T& operator [](std::size_t idx)       { return m_data[idx]; }
-            const T& operator [](std::size_t idx) const { return m_data[idx]; }
+        // record counters of an expression evaluation
+        template<typename Expression> void expression(const char* xi_operation, const Sample& xi_before, const Sample& xi_after, const std::size_t xi_elements) {
+#if defined(LAZY_VECTOR_PERF_COUNTERS) && defined(__linux__)
+            static const std::string name{ ExpressionTraits::name<Expression>() };
+            record(&name, xi_operation, name, xi_after - xi_before, xi_elements);
+#else
+            (void)xi_operation;
+            (void)xi_before;
+            (void)xi_after;
+            (void)xi_elements;
+#endif
+        }
 
-            // like [] but with exceptions
-            T& at(std::size_t pos) {
-                if (pos < m_size) {
-                    return m_data[pos];
-                } 
-                else {
-                    throw std::out_of_range("accessed position is out of range.");
+        /**
+        * \brief a user defined region - counters accumulated while it is alive are recorded under its name
+        *        (regions with the same name string literal are aggregated)
+        **/
+        class Region {
+            // properties
+            private:
+                const char* m_name;
+                Sample m_start;
+
+            // constructors
+            public:
+                explicit Region(const char* xi_name) noexcept : m_name(xi_name), m_start(read()) {}
+
+                ~Region() {
+#if defined(LAZY_VECTOR_PERF_COUNTERS) && defined(__linux__)
+                    record(m_name, "region", m_name, read() - m_start, 0);
+#endif
                 }
+
+                Region(const Region&) = delete;
+                Region& operator=(const Region&) = delete;
+        };
+
+        // all entries, sorted by cycles (descending)
+        inline std::vector<Entry> report() {
+            std::vector<Entry> out;
+#if defined(LAZY_VECTOR_PERF_COUNTERS) && defined(__linux__)
+            {
+                State& current{ state() };
+                std::lock_guard<std::mutex> lock(current.mutex);
+                out = current.entries;
             }
+            std::sort(out.begin(), out.end(), [](const Entry& a, const Entry& b) { return a.totals.values[Cycles] > b.totals.values[Cycles]; });
+#endif
+            return out;
+        }
 
-            const T& at(std::size_t pos) const {
-                if (pos < m_size) {
-                    return m_data[pos];
-                } 
+        // write the report as a table (per element values - totals for regions, instructions per cycle; '-' marks unavailable counters)
+        inline void write_report(std::ostream& xo_stream) {
+            xo_stream << "calls      elements     cycles/el   instr/el    IPC     llc-miss/el  dtlb-miss/el  operation / expression\n";
+            for (const Entry& entry : report()) {
+                const double elements{ static_cast<double>(std::max<std::size_t>(entry.elements, 1)) };
+                const auto field = [&entry, elements](const std::size_t xi_counter) {
+                    char text[32];
+                    if (entry.totals.valid[xi_counter]) std::snprintf(text, sizeof(text), "%.4f", static_cast<double>(entry.totals.values[xi_counter]) / elements);
+                    else std::snprintf(text, sizeof(text), "-");
+                    return std::string(text);
+                };
+
+                char ipc[32];
+                if (entry.totals.valid[Cycles] && entry.totals.valid[Instructions] && (entry.totals.values[Cycles] > 0)) {
+                    std::snprintf(ipc, sizeof(ipc), "%.2f", static_cast<double>(entry.totals.values[Instructions]) / static_cast<double>(entry.totals.values[Cycles]));
+                }
                 else {
-                    throw std::out_of_range("accessed position is out of range");
+                    std::snprintf(ipc, sizeof(ipc), "-");
                 }
+
+                char line[192];
+                std::snprintf(line, sizeof(line), "%-10zu %-12zu %-11s %-11s %-7s %-12s %-13s ", entry.calls, entry.elements, field(Cycles).c_str(),
+                              field(Instructions).c_str(), ipc, field(CacheMisses).c_str(), field(TlbMisses).c_str());
+                xo_stream << line << entry.operation << " " << entry.name << "\n";
             }
+        }
 
-            // return first element
-                  T& front()       { return m_data[0]; }
-            const T& front() const { return m_data[0]; }
+        // discard all recorded counters
+        inline void reset() {
+#if defined(LAZY_VECTOR_PERF_COUNTERS) && defined(__linux__)
+            State& current{ state() };
+            std::lock_guard<std::mutex> lock(current.mutex);
+            current.entries.clear();
+            current.keys.clear();
+#endif
+        }
+    };
 
-            // return last element
-                  T& back()       { return m_data[m_size - 1]; }
-            const T& back() const { return m_data[m_size - 1]; };
+    /**
+    * memory footprint registry - compiled in only when LAZY_VECTOR_FOOTPRINT is defined.
+    * every live vector is registered (at construction) together with the site it was constructed at - the innermost
+    * Footprint::Region of the constructing thread. the registry reports size versus capacity (in bytes, element owned heap
+    * memory is not included) in total and per site, and trims all vectors whose unused capacity exceeds a threshold.
+    **/
+    namespace Footprint {
+
+#if defined(LAZY_VECTOR_FOOTPRINT)
+        constexpr bool Enabled{ true };
+#else
+        constexpr bool Enabled{ false };
+#endif
+
+        using Site = Profiling::Site;
+
+        /**
+        * \brief memory held by a group of vectors
+        **/
+        struct Usage {
+            Site site;
+            std::size_t vectors{};
+            std::size_t sizeBytes{};        // bytes holding elements
+            std::size_t capacityBytes{};    // bytes allocated
+
+            std::size_t waste() const noexcept { return capacityBytes - sizeBytes; }
+        };
+
+#if defined(LAZY_VECTOR_FOOTPRINT)
+        // type erased access to a vector
+        struct Type {
+            std::size_t elementSize;
+            std::size_t(*size)(const void*);
+            std::size_t(*capacity)(const void*);
+            void(*shrink)(void*);
+        };
+
+        template<typename T> const Type* type() noexcept {
+            static const Type instance{ sizeof(T),
+                                        [](const void* xi_vector) { return static_cast<const Vector<T>*>(xi_vector)->size(); },
+                                        [](const void* xi_vector) { return static_cast<const Vector<T>*>(xi_vector)->capacity(); },
+                                        [](void* xi_vector) { static_cast<Vector<T>*>(xi_vector)->shrink_to_fit(); } };
+            return &instance;
+        }
 
-        // underlying data access
-        public:
-                  T* data()       noexcept { return m_data; }
-            const T* data() const noexcept { return m_data; }
+        struct Record {
+            const Type* type;
+            Site site;
+        };
 
-        // general modifiers
-        public:
-            
-            // emplace elements to vector head
-            template <class... Args> void emplace_back(Args&& ... args) {
-                if (m_size == m_reservedSize) {
-                    m_reservedSize *= 2;
-                    reallocate();
+        struct State {
+            std::mutex mutex;
+            std::map<const void*, Record> vectors;
+        };
+
+        // never destroyed, so that vectors with static storage duration can unregister during exit
+        inline State& state() {
+            static State& instance{ *new State };
+            return instance;
+        }
+
+        // innermost region of the calling thread
+        inline const Site*& region_site() noexcept {
+            thread_local const Site* site{ nullptr };
+            return site;
+        }
+#endif
+
+        // register a constructed vector
+        template<typename T> void constructed(const Vector<T>* xi_vector) {
+#if defined(LAZY_VECTOR_FOOTPRINT)
+            const Site* site{ region_site() };
+            State& current{ state() };
+            std::lock_guard<std::mutex> lock(current.mutex);
+            current.vectors[xi_vector] = Record{ type<T>(), (site != nullptr) ? *site : Site{} };
+#else
+            (void)xi_vector;
+#endif
+        }
+
+        // unregister a destroyed vector
+        template<typename T> void destroyed(const Vector<T>* xi_vector) {
+#if defined(LAZY_VECTOR_FOOTPRINT)
+            State& current{ state() };
+            std::lock_guard<std::mutex> lock(current.mutex);
+            current.vectors.erase(xi_vector);
+#else
+            (void)xi_vector;
+#endif
+        }
+
+        /**
+        * \brief a scope whose (same thread) vector constructions are attributed to its site
+        *        (i.e. - 'Lazy::Footprint::Region region;' at the top of a function attributes all vectors it creates to that function)
+        **/
+        class Region {
+#if defined(LAZY_VECTOR_FOOTPRINT)
+            // properties
+            private:
+                Site m_site;
+                const Site* m_parent;
+
+            // constructors
+            public:
+                explicit Region(const Site xi_site = Site::current()) : m_site(xi_site), m_parent(region_site()) {
+                    region_site() = &m_site;
                 }
-                m_data[m_size] = std::move(T(std::forward<Args>(args) ...));
-                ++m_size;
-            }
 
-            // push element to vector head
-            void push_back(const T& xi_value) {
-                if (m_size == m_reservedSize) {
-                    m_reservedSize *= 2;
-                    reallocate();
+                ~Region() {
+                    region_site() = m_parent;
                 }
-                m_data[m_size] = xi_value;
-                ++m_size;
+#else
+            public:
+                explicit Region(const Site = Site::current()) noexcept {}
+#endif
+
+                Region(const Region&) = delete;
+                Region& operator=(const Region&) = delete;
+        };
+
+        // memory held by all live vectors
+        inline Usage total() {
+            Usage out;
+#if defined(LAZY_VECTOR_FOOTPRINT)
+            State& current{ state() };
+            std::lock_guard<std::mutex> lock(current.mutex);
+            for (const auto& vector : current.vectors) {
+                const Type& type{ *vector.second.type };
+                ++out.vectors;
+                out.sizeBytes += type.size(vector.first) * type.elementSize;
+                out.capacityBytes += type.capacity(vector.first) * type.elementSize;
             }
+#endif
+            return out;
+        }
 
-            void push_back(T&& xi_value) {
-                if (m_size == m_reservedSize) {
-                    m_reservedSize *= 2;
-                    reallocate();
+        // memory held by live vectors per construction site, sorted by wasted bytes (descending)
+        inline std::vector<Usage> report() {
+            std::vector<Usage> out;
+#if defined(LAZY_VECTOR_FOOTPRINT)
+            {
+                State& current{ state() };
+                std::lock_guard<std::mutex> lock(current.mutex);
+                std::map<std::pair<std::string_view, std::size_t>, std::size_t> index;
+                for (const auto& vector : current.vectors) {
+                    const Record& record{ vector.second };
+                    const auto found{ index.emplace(std::make_pair(std::string_view(record.site.file), record.site.line), out.size()) };
+                    if (found.second) {
+                        out.push_back(Usage{ record.site });
+                    }
+
+                    Usage& usage{ out[found.first->second] };
+                    ++usage.vectors;
+                    usage.sizeBytes += record.type->size(vector.first) * record.type->elementSize;
+                    usage.capacityBytes += record.type->capacity(vector.first) * record.type->elementSize;
                 }
-                m_data[m_size] = std::move(xi_value);
-                ++m_size;
             }
+            std::sort(out.begin(), out.end(), [](const Usage& a, const Usage& b) { return a.waste() > b.waste(); });
+#endif
+            return out;
+        }
 
-            // remove element from vector head
-            void pop_back() {
-                --m_size;
-                m_data[m_size].~T();
+        // write the report as a table
+        inline void write_report(std::ostream& xo_stream) {
+            const auto line = [&xo_stream](const Usage& xi_usage, const std::string& xi_site) {
+                char fields[128];
+                std::snprintf(fields, sizeof(fields), "%-9zu %-14zu %-14zu %-14zu %-8.1f ", xi_usage.vectors, xi_usage.sizeBytes, xi_usage.capacityBytes, xi_usage.waste(),
+                              (xi_usage.capacityBytes > 0) ? 100.0 * static_cast<double>(xi_usage.waste()) / static_cast<double>(xi_usage.capacityBytes) : 0.0);
+                xo_stream << fields << xi_site << "\n";
+            };
+
+            xo_stream << "vectors   size[bytes]    capacity[bytes] waste[bytes]  waste[%] site\n";
+            for (const Usage& usage : report()) {
+                line(usage, std::string(usage.site.file) + ":" + std::to_string(usage.site.line));
             }
+            line(total(), "total");
+        }
 
-            // push elements to a vector from a given iterator, return iterator to last element 
-            template <class ... Args> T* emplace(const T* xi_iterator, Args&& ... args) {
-                iterator iit{ &m_data[xi_iterator - m_data] };
-                if (m_size == m_reservedSize) {
-                    m_reservedSize *= 2;
-                    reallocate();
+        /**
+        * \brief shrink (to their size) all live vectors whose unused capacity exceeds a given fraction of their capacity.
+        *        no other thread may use a registered vector while trimming.
+        *
+        * @param {double, in}  minimal wasted fraction of capacity (0.5 by default)
+        * @param {size_t, in}  minimal wasted bytes (vectors wasting less are kept)
+        * @param {size_t, out} released bytes
+        **/
+        inline std::size_t trim(const double xi_waste = 0.5, const std::size_t xi_minimalBytes = 0) {
+            std::size_t released{};
+#if defined(LAZY_VECTOR_FOOTPRINT)
+            // vectors are selected under the registry lock, and shrunk after releasing it (shrinking waits for pending asynchronous
+            // assignments, which may construct vectors themselves)
+            std::vector<std::pair<const void*, const Type*>> wasteful;
+            {
+                State& current{ state() };
+                std::lock_guard<std::mutex> lock(current.mutex);
+                for (const auto& vector : current.vectors) {
+                    const Type& type{ *vector.second.type };
+                    const std::size_t size{ type.size(vector.first) * type.elementSize },
+                                      capacity{ type.capacity(vector.first) * type.elementSize },
+                                      waste{ capacity - size };
+                    if ((waste > xi_minimalBytes) && (static_cast<double>(waste) > xi_waste * static_cast<double>(capacity))) {
+                        wasteful.emplace_back(vector.first, &type);
+                        released += waste;
+                    }
                 }
-
-                memmove(iit + 1, iit, (m_size - (xi_iterator - m_data)) * sizeof(T));
-                (*iit) = std::move(T(std::forward<Args>(args) ...));
-                ++m_size;
-
-                return iit;
             }
+            for (const auto& vector : wasteful) {
+                vector.second->shrink(const_cast<void*>(vector.first));
+            }
+#else
+            (void)xi_waste;
+            (void)xi_minimalBytes;
+#endif
+            return released;
+        }
+    };
 
-            // insert an element to a vector from a given iterator, return iterator to element
-            T* insert(const T* xi_iterator, const T& xi_value) {
-                iterator iit{ &m_data[xi_iterator - m_data] };
+    /**
+    * scratch arena - a per thread bump allocator for evaluation temporaries (tiles, partial results) and user temporaries.
+    * allocations are released together when the enclosing Scratch::Scope ends; when the outermost scope of a thread ends
+    * (the end of a top level evaluation) the arena is reset, and if it grew beyond a single chunk it is coalesced into
+    * one chunk large enough for the peak usage, so steady state evaluation performs no allocations.
+    **/
+    namespace Scratch {
+
+        // chunk alignment (and largest supported allocation alignment)
+        constexpr std::size_t Alignment{ 64 };
+
+        // smallest chunk
+        constexpr std::size_t MinimalChunk{ 64 * 1024 };
+
+        /**
+        * \brief bump allocator over a list of chunks
+        **/
+        class Arena {
+            // a position in the arena
+            public:
+                struct Marker {
+                    std::size_t chunk;
+                    std::size_t offset;
+                };
+
+            // properties
+            private:
+                struct Chunk {
+                    std::byte* data;
+                    std::size_t bytes;
+                };
+
+                std::vector<Chunk> m_chunks;
+                Marker m_top{ 0, 0 };           // next free byte
+                std::size_t m_peak{};           // largest used() since reset
+                std::size_t m_depth{};          // amount of open scopes
+
+            // internal methods
+            private:
+                static std::byte* acquire(const std::size_t xi_bytes) {
+                    return static_cast<std::byte*>(::operator new(xi_bytes, std::align_val_t{ Alignment }));
+                }
 
-                if (m_size == m_reservedSize) {
-                    m_reservedSize *= 2;
-                    reallocate();
+                static void discard(const Chunk& xi_chunk) noexcept {
+                    ::operator delete(xi_chunk.data, std::align_val_t{ Alignment });
                 }
 
-                memmove(iit + 1, iit, (m_size - (xi_iterator - m_data)) * sizeof(T));
-                (*iit) = xi_value;
-                ++m_size;
+            // constructors
+            public:
+                Arena() = default;
+                Arena(const Arena&) = delete;
+                Arena& operator=(const Arena&) = delete;
 
-                return iit;
-            }
+                ~Arena() {
+                    release();
+                }
 
-            
-            T* insert(const T* xi_iterator, T&& xi_value) {
-                iterator iit{ &m_data[xi_iterator - m_data] };
+            // allocation
+            public:
+
+                /**
+                * \brief allocate uninitialized memory (valid until the arena is rewound beyond it)
+                *
+                * @param {size_t, in}  size (bytes)
+                * @param {size_t, in}  alignment (power of two, not above Scratch::Alignment)
+                * @param {void*,  out} memory
+                **/
+                void* allocate(const std::size_t xi_bytes, const std::size_t xi_alignment = alignof(std::max_align_t)) {
+                    assert((xi_alignment <= Alignment) && ((xi_alignment & (xi_alignment - 1)) == 0));
+
+                    // find a chunk with enough room (chunks beyond the top one are empty, and reused in order)
+                    for (; m_top.chunk < m_chunks.size(); ++m_top.chunk, m_top.offset = 0) {
+                        const std::size_t offset{ (m_top.offset + xi_alignment - 1) & ~(xi_alignment - 1) };
+                        if ((offset <= m_chunks[m_top.chunk].bytes) && (xi_bytes <= m_chunks[m_top.chunk].bytes - offset)) {
+                            m_top.offset = offset + xi_bytes;
+                            m_peak = std::max(m_peak, used());
+                            return m_chunks[m_top.chunk].data + offset;
+                        }
+                    }
 
-                if (m_size == m_reservedSize) {
-                    m_reservedSize *= 2;
-                    reallocate();
+                    // new chunk
+                    const std::size_t bytes{ std::max({ MinimalChunk, m_chunks.empty() ? std::size_t{} : 2 * m_chunks.back().bytes,
+                                                        (xi_bytes + Alignment - 1) & ~(Alignment - 1) }) };
+                    m_chunks.reserve(m_chunks.size() + 1);
+                    m_chunks.push_back({ acquire(bytes), bytes });
+                    m_top = { m_chunks.size() - 1, xi_bytes };
+                    m_peak = std::max(m_peak, used());
+                    return m_chunks.back().data;
                 }
 
-                memmove(iit + 1, iit, (m_size - (xi_iterator - m_data)) * sizeof(T));
-                (*iit) = std::move(xi_value);
-                ++m_size;
+                // current position (allocations made after it are released by rewind)
+                Marker mark() const noexcept {
+                    return m_top;
+                }
 
-                return iit;
-            }
+                // release all allocations made after a marker
+                void rewind(const Marker xi_marker) noexcept {
+                    m_top = xi_marker;
+                }
 
-            // insert an element a given number of times to a vector from a given iterator, return iterator to element
-            T* insert(const T* xi_iterator, std::size_t xi_count, const T &xi_value) {
-                iterator f{ &m_data[xi_iterator - m_data] };
-                if (!xi_count) return f;
+                // release all allocations - a multi chunk arena is coalesced into a single chunk which fits its peak usage
+                void reset() {
+                    m_top = { 0, 0 };
+                    if (m_chunks.size() > 1) {
+                        const std::size_t bytes{ (m_peak + Alignment - 1) & ~(Alignment - 1) };
+                        release();
+                        m_chunks.push_back({ acquire(bytes), bytes });
+                    }
+                    m_peak = 0;
+                }
 
-                if (m_size + xi_count > m_reservedSize) {
-                    m_reservedSize = (m_size + xi_count) << 2;
-                    reallocate();
+                // return all chunks to the system (the arena must not hold live allocations)
+                void release() noexcept {
+                    for (const Chunk& chunk : m_chunks) {
+                        discard(chunk);
+                    }
+                    m_chunks.clear();
+                    m_top = { 0, 0 };
                 }
 
-                memmove(f + xi_count, f, (m_size - (xi_iterator - m_data)) * sizeof(T));
-                m_size += xi_count;
+            // queries
+            public:
 
-                for (iterator xi_iterator = f; xi_count--; ++xi_iterator) {
-                    (*xi_iterator) = xi_value;
+                // bytes allocated by the arena
+                std::size_t reserved() const noexcept {
+                    std::size_t bytes{};
+                    for (const Chunk& chunk : m_chunks) {
+                        bytes += chunk.bytes;
+                    }
+                    return bytes;
                 }
-                return f;
-            }
 
-            // insert an elements given by iterator range to a vector at a given iterator, return iterator to last element inserted
-            template<class InputIt> T* insert(const T* xi_iterator, InputIt xi_first, InputIt xi_last) {
-                iterator f{ &m_data[xi_iterator - m_data] };
-                const std::size_t cnt{ xi_last - xi_first };
-                if (!cnt) return f;
-
-                if (m_size + cnt > m_reservedSize) {
-                    m_reservedSize = (m_size + cnt) << 2;
-                    reallocate();
+                // bytes currently handed out (padding and unused chunk tails included)
+                std::size_t used() const noexcept {
+                    std::size_t bytes{ m_top.offset };
+                    for (std::size_t i{}; (i < m_top.chunk) && (i < m_chunks.size()); ++i) {
+                        bytes += m_chunks[i].bytes;
+                    }
+                    return bytes;
                 }
 
-                memmove(f + cnt, f, (m_size - (xi_iterator - m_data)) * sizeof(T));
-                for (iterator xi_iterator = f; xi_first != xi_last; ++xi_iterator, ++xi_first) {
-                    (*xi_iterator) = *xi_first;
+                // amount of open scopes
+                std::size_t depth() const noexcept {
+                    return m_depth;
                 }
-                m_size += cnt;
 
-                return f;
-            }
+            friend class Scope;
+        };
 
-            // insert a list to a vector at a given iterator, return iterator to last element inserted
-            T* insert(const T* xi_iterator, std::initializer_list<T> xi_list) {
-                const std::size_t cnt{ xi_list.size() };
-                iterator f{ &m_data[xi_iterator - m_data] };
-                if (!cnt) return f;
+        // the calling thread arena
+        inline Arena& arena() {
+            thread_local Arena instance;
+            return instance;
+        }
 
-                if (m_size + cnt > m_reservedSize) {
-                    m_reservedSize = (m_size + cnt) << 2;
-                    reallocate();
+        /**
+        * \brief a scope whose arena allocations are released when it ends (the arena is reset when the outermost scope ends)
+        **/
+        class Scope {
+            // properties
+            private:
+                Arena& m_arena;
+                Arena::Marker m_marker;
+
+            // constructors
+            public:
+                Scope() : m_arena(arena()), m_marker(m_arena.mark()) {
+                    ++m_arena.m_depth;
                 }
 
-                memmove(f + cnt, f, (m_size - (xi_iterator - m_data)) * sizeof(T));
-                iterator iit = f;
-                for (auto &item : xi_list) {
-                    (*iit) = item;
-                    ++iit;
+                ~Scope() {
+                    if (--m_arena.m_depth == 0) {
+                        try {
+                            m_arena.reset();
+                        }
+                        catch (const std::bad_alloc&) {
+                            m_arena.release();
+                        }
+                    }
+                    else {
+                        m_arena.rewind(m_marker);
+                    }
                 }
-                m_size += cnt;
 
-                return f;
-            }
+                Scope(const Scope&) = delete;
+                Scope& operator=(const Scope&) = delete;
+        };
+
+        /**
+        * \brief an array of default constructed elements in the calling thread arena (elements are destroyed with the array,
+        *        its memory is released by the enclosing scope). elements aligned beyond Scratch::Alignment are held on the heap instead.
+        *
+        * @param {T, in} element type
+        **/
+        template<typename T> class Array {
+            // over aligned elements do not fit the arena
+            static constexpr bool Heap{ alignof(T) > Alignment };
+
+            // properties
+            private:
+                T* m_data;
+                std::size_t m_size;
+
+            // internal methods
+            private:
+                static T* allocate(const std::size_t xi_size) {
+                    if constexpr (Heap) {
+                        return static_cast<T*>(::operator new(xi_size * sizeof(T), std::align_val_t{ alignof(T) }));
+                    }
+                    else {
+                        return static_cast<T*>(arena().allocate(xi_size * sizeof(T), alignof(T)));
+                    }
+                }
 
-            // erase element at a given iterator, return iterator to element found at new 'index'
-            T* erase(const T* xi_iterator) {
-                iterator iit{ &m_data[xi_iterator - m_data] };
+                static void deallocate(T* xi_data) noexcept {
+                    if constexpr (Heap) {
+                        ::operator delete(xi_data, std::align_val_t{ alignof(T) });
+                    }
+                    else {
+                        (void)xi_data;
+                    }
+                }
 
-                if constexpr (!std::is_arithmetic<T>::value) {
-                    (*iit).~T();
+            // constructors
+            public:
+                explicit Array(const std::size_t xi_size) : m_data(allocate(xi_size)), m_size(xi_size) {
+                    try {
+                        std::uninitialized_default_construct_n(m_data, m_size);
+                    }
+                    catch (...) {
+                        deallocate(m_data);
+                        throw;
+                    }
                 }
 
-                memmove(iit, iit + 1, (m_size - (xi_iterator - m_data) - 1) * sizeof(T));
-                --m_size;
+                ~Array() {
+                    std::destroy_n(m_data, m_size);
+                    deallocate(m_data);
+                }
 
-                return iit;
-            }
+                Array(const Array&) = delete;
+                Array& operator=(const Array&) = delete;
+
+            // access
+            public:
+                T* data() noexcept { return m_data; }
+                const T* data() const noexcept { return m_data; }
+                std::size_t size() const noexcept { return m_size; }
+                T& operator[](const std::size_t xi_index) noexcept { return m_data[xi_index]; }
+                const T& operator[](const std::size_t xi_index) const noexcept { return m_data[xi_index]; }
+        };
+    };
 
-            // erase elements at a given range, return iterator to element found at new 'index'
-            T* erase(const T* xi_first, const T* xi_last) {
-                iterator f{ &m_data[xi_first - m_data] };
-                if (xi_first == xi_last) return f;
+    /**
+    * memory release policy - vectors keep their capacity unless told otherwise. Memory::settings() enables automatic shrinking
+    * (when removals leave a vector holding far fewer elements than its capacity), Vector::release_unused() returns the pages of a
+    * vector unused capacity to the operating system in place, and Memory::pressure() releases memory on demand (trimming all
+    * registered vectors when LAZY_VECTOR_FOOTPRINT is defined, and invoking user handlers) - it can be called by the application
+    * on a memory pressure signal (a failing allocation only empties the buffer caches, Memory::install_new_handler).
+    **/
+    namespace Memory {
+
+        /**
+        * \brief release policy
+        **/
+        struct Settings {
+            double shrinkFraction{ 0.0 };           // shrink vectors whose size drops below this fraction of their capacity (0 - never)
+            std::size_t shrinkBytes{ 64 * 1024 };   // vectors whose capacity is smaller than this (bytes) are never shrunk automatically
+            double pressureWaste{ 0.25 };           // on memory pressure, trim vectors whose unused fraction of capacity exceeds this
+            std::size_t poolBlockBytes{ 1 << 22 };  // largest buffer recycled by the pool (0 - pool disabled)
+            std::size_t poolThreadBytes{ 1 << 24 }; // bytes cached per thread
+            std::size_t poolSharedBytes{ 1 << 26 }; // bytes cached by the shared pool
+        };
+
+        inline Settings& settings() noexcept {
+            static Settings instance;
+            return instance;
+        }
 
-                if constexpr (!std::is_arithmetic<T>::value) {
-                    for (; xi_first != xi_last; ++xi_first) {
-                        (*xi_first).~T();
-                    }
+        // operating system page size
+        inline std::size_t page_size() noexcept {
+#if defined(__unix__) || defined(__APPLE__)
+            static const std::size_t size{ static_cast<std::size_t>(sysconf(_SC_PAGESIZE)) };
+            return size;
+#else
+            return 4096;
+#endif
+        }
+
+        /**
+        * \brief tell the operating system that the whole pages within a memory range are no longer needed. the range stays mapped,
+        *        and its content becomes unspecified (pages are either kept or refaulted as zeroes).
+        *
+        * @param {void*,  in}  range start
+        * @param {size_t, in}  range length (bytes)
+        * @param {size_t, out} amount of bytes released
+        **/
+        inline std::size_t advise(void* xi_first, const std::size_t xi_bytes) noexcept {
+#if defined(__unix__) || defined(__APPLE__)
+            const std::size_t page{ page_size() },
+                              first{ reinterpret_cast<std::uintptr_t>(xi_first) },
+                              start{ (first + page - 1) & ~(page - 1) },
+                              end{ (first + xi_bytes) & ~(page - 1) };
+            if (end <= start) return 0;
+
+#if defined(MADV_FREE)
+            if (madvise(reinterpret_cast<void*>(start), end - start, MADV_FREE) == 0) return end - start;
+#endif
+            return (madvise(reinterpret_cast<void*>(start), end - start, MADV_DONTNEED) == 0) ? end - start : 0;
+#else
+            (void)xi_first;
+            (void)xi_bytes;
+            return 0;
+#endif
+        }
+
+        // set while the calling thread updates the pool caches or releases memory for a failing allocation - the new handler
+        // (install_new_handler) gives up instead of touching the caches (or re-entering itself) meanwhile
+        inline bool& reclaiming() noexcept {
+            thread_local bool instance{ false };
+            return instance;
+        }
+
+        struct Reclaiming {
+            bool previous{ std::exchange(reclaiming(), true) };
+            ~Reclaiming() { reclaiming() = previous; }
+        };
+
+        /**
+        * buffer recycling pool - vector buffers are drawn from (and returned to) power of two size classes, cached per thread
+        * and backed by a shared pool, so that vectors of recurring sizes are served without system allocations.
+        * every block is preceded by a header (its size class and element count); blocks above Settings::poolBlockBytes,
+        * and blocks which do not fit the caches, go to the global allocation functions (::operator new/delete).
+        **/
+        namespace Pool {
+
+            // block header size (keeps the block fundamentally aligned)
+            constexpr std::size_t HeaderBytes{ alignof(std::max_align_t) };
+
+            // size classes - a class holds blocks of 2^class bytes (header included)
+            constexpr std::size_t MinimalClass{ 6 };
+            constexpr std::size_t Classes{ 8 * sizeof(std::size_t) };
+
+            // class of blocks not pooled
+            constexpr std::size_t Unpooled{ Classes };
+
+            struct Header {
+                std::size_t sizeClass;
+                std::size_t count;      // elements held (as given when acquired)
+            };
+            static_assert(sizeof(Header) <= HeaderBytes, "pool block header does not fit its alignment");
+
+            /**
+            * \brief pool activity
+            **/
+            struct Statistics {
+                std::size_t hits{};             // acquisitions served by the thread cache
+                std::size_t sharedHits{};       // acquisitions served by the shared pool
+                std::size_t misses{};           // acquisitions served by the system allocator
+                std::size_t cachedBytes{};      // bytes held by the shared pool
+
+                double hit_rate() const noexcept {
+                    const std::size_t total{ hits + sharedHits + misses };
+                    return (total > 0) ? static_cast<double>(hits + sharedHits) / static_cast<double>(total) : 0.0;
                 }
+            };
 
-                memmove(f, xi_last, (m_size - (xi_last - m_data)) * sizeof(T));
-                m_size -= xi_last - xi_first;
+            struct Counters {
+                std::atomic<std::size_t> hits{};
+                std::atomic<std::size_t> sharedHits{};
+                std::atomic<std::size_t> misses{};
+            };
 
-                return f;
+            inline Counters& counters() noexcept {
+                static Counters instance;
+                return instance;
             }
 
-            // swap two vectors
-            void swap(Vector<T> &rhs) {
-                const size_t tvec_sz{ m_size },
-                             trsrv_sz{ m_reservedSize };
-                T *tarr = m_data;
-
-                m_size = rhs.m_size;
-                m_reservedSize = rhs.m_reservedSize;
-                m_data = rhs.m_data;
+            // shared pool (never destroyed, so that buffers released during exit can still be returned)
+            struct Shared {
+                std::mutex mutex;
+                std::vector<void*> blocks[Classes];
+                std::size_t bytes{};
+            };
 
-                rhs.m_size = tvec_sz;
-                rhs.m_reservedSize = trsrv_sz;
-                rhs.m_data = tarr;
+            inline Shared& shared() {
+                static Shared& instance{ *new Shared };
+                return instance;
             }
 
-            // clear a vector
-            void clear() noexcept {
-                if constexpr (!std::is_arithmetic<T>::value) {
-                    for (std::size_t i{}; i < m_size; ++i) {
-                        m_data[i].~T();
+            // return a block to the shared pool, or to the system if the shared pool is full
+            inline void give(void* xi_block, const std::size_t xi_class) {
+                const std::size_t bytes{ std::size_t{ 1 } << xi_class };
+                {
+                    Reclaiming guard;
+                    Shared& pool{ shared() };
+                    std::lock_guard<std::mutex> lock(pool.mutex);
+                    if (pool.bytes + bytes <= settings().poolSharedBytes) {
+                        pool.blocks[xi_class].push_back(xi_block);
+                        pool.bytes += bytes;
+                        return;
                     }
                 }
-                m_size = 0;
+                ::operator delete(xi_block);
             }
 
-        // 'numerical'/logical/bitwise operator overload
-        public:
+            // per thread cache, its blocks are handed to the shared pool when the thread exits
+            struct Cache {
+                std::vector<void*> blocks[Classes];
+                std::size_t bytes{};
 
-            // '+'/'+=' overload 
-            template<typename RightExpr> Vector& operator +=(RightExpr&& xi_expression) {
-                for (std::size_t i{}; i < m_size; ++i) {
-                    m_data[i] += xi_expression[i];
+                ~Cache() {
+                    alive() = false;
+                    for (std::size_t c{}; c < Classes; ++c) {
+                        for (void* block : blocks[c]) {
+                            give(block, c);
+                        }
+                    }
                 }
-                return *this;
-            }
-            template<typename RightExpr> auto operator +(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::ADD<T>, decltype(std::forward<RightExpr>(xi_expression))> {
-                return BinaryExpression<const Vector&, BinaryOperations::ADD<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
-            }
 
-            // '-'/'-=' overload 
-            template<typename RightExpr> Vector& operator -=(RightExpr&& xi_expression) {
-                for (std::size_t i{}; i < m_size; ++i) {
-                        m_data[i] -= xi_expression[i];
+                static bool& alive() noexcept {
+                    thread_local bool instance{ true };
+                    return instance;
                 }
-                return *this;
+            };
+
+            inline Cache* cache() {
+                if (!Cache::alive()) return nullptr;
+                thread_local Cache instance;
+                return &instance;
             }
-            template<typename RightExpr> auto operator -(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::SUB<T>, decltype(std::forward<RightExpr>(xi_expression))> {
-                return BinaryExpression<const Vector&, BinaryOperations::SUB<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+
+            // size class of a block holding a given amount of bytes (Unpooled if it is too large to be pooled)
+            inline std::size_t size_class(const std::size_t xi_bytes) noexcept {
+                const std::size_t bytes{ xi_bytes + HeaderBytes };
+                if ((settings().poolBlockBytes == 0) || (xi_bytes > settings().poolBlockBytes) || (bytes < xi_bytes)) return Unpooled;
+
+                std::size_t c{ MinimalClass };
+                while ((std::size_t{ 1 } << c) < bytes) ++c;
+                return c;
             }
 
-            // '*'/'*=' overload 
-            template<typename RightExpr> Vector& operator *=(RightExpr&& xi_expression) {
-                for (std::size_t i{}; i < m_size; ++i) {
-                    m_data[i] *= xi_expression[i];
+            /**
+            * \brief acquire a buffer
+            *
+            * @param {size_t, in}  buffer size (bytes)
+            * @param {size_t, in}  amount of elements it will hold (returned by count())
+            * @param {void*,  out} buffer (fundamentally aligned)
+            **/
+            LAZY_VECTOR_NOINLINE void* acquire(const std::size_t xi_bytes, const std::size_t xi_count) {
+                const std::size_t c{ size_class(xi_bytes) };
+                void* block{ nullptr };
+
+                if (c != Unpooled) {
+                    if (Cache* local{ cache() }; (local != nullptr) && !local->blocks[c].empty()) {
+                        block = local->blocks[c].back();
+                        local->blocks[c].pop_back();
+                        local->bytes -= std::size_t{ 1 } << c;
+                        counters().hits.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    else {
+                        Shared& pool{ shared() };
+                        std::lock_guard<std::mutex> lock(pool.mutex);
+                        if (!pool.blocks[c].empty()) {
+                            block = pool.blocks[c].back();
+                            pool.blocks[c].pop_back();
+                            pool.bytes -= std::size_t{ 1 } << c;
+                            counters().sharedHits.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
                 }
-                return *this;
-            }
-            template<typename RightExpr> auto operator *(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::MUL<T>, decltype(std::forward<RightExpr>(xi_expression))> {
-                return BinaryExpression<const Vector&, BinaryOperations::MUL<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
-            }
 
-            // '/'/'/=' overload 
-            template<typename RightExpr> Vector& operator /=(RightExpr&& xi_expression) {
-                for (std::size_t i{}; i < m_size; ++i) {
-                    m_data[i] /= xi_expression[i];
+                if (block == nullptr) {
+                    if ((c == Unpooled) && (xi_bytes + HeaderBytes < xi_bytes)) throw std::bad_alloc();
+                    block = ::operator new((c == Unpooled) ? xi_bytes + HeaderBytes : std::size_t{ 1 } << c);
+                    counters().misses.fetch_add(1, std::memory_order_relaxed);
                 }
-                return *this;
+
+                ::new (block) Header{ c, xi_count };
+                return static_cast<char*>(block) + HeaderBytes;
             }
-            template<typename RightExpr> auto operator /(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::DIV<T>, decltype(std::forward<RightExpr>(xi_expression))> {
-                return BinaryExpression<const Vector&, BinaryOperations::DIV<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+
+            // amount of elements a buffer holds
+            inline std::size_t count(const void* xi_buffer) noexcept {
+                return reinterpret_cast<const Header*>(static_cast<const char*>(xi_buffer) - HeaderBytes)->count;
             }
 
-            // '&'/'&=' overload 
-            template<typename RightExpr> Vector& operator &=(RightExpr&& xi_expression) {
-                for (std::size_t i{}; i < m_size; ++i) {
-                    m_data[i] &= xi_expression[i];
+            // release a buffer (to the thread cache, the shared pool or the system)
+            LAZY_VECTOR_NOINLINE void release(void* xi_buffer) noexcept {
+                if (xi_buffer == nullptr) return;
+
+                void* block{ static_cast<char*>(xi_buffer) - HeaderBytes };
+                const std::size_t c{ static_cast<const Header*>(block)->sizeClass };
+                if (c == Unpooled) {
+                    ::operator delete(block);
+                    return;
                 }
-                return *this;
-            }
-            template<typename RightExpr> auto operator &(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::LAND<T>, decltype(std::forward<RightExpr>(xi_expression))> {
-                return BinaryExpression<const Vector&, BinaryOperations::LAND<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
-            }
 
-            // '|'/'|=' overload 
-            template<typename RightExpr> Vector& operator |=(RightExpr&& xi_expression) {
-                for (std::size_t i{}; i < m_size; ++i) {
-                    m_data[i] |= xi_expression[i];
+                // a thread keeps the blocks it releases, up to its cache limit
+                const std::size_t bytes{ std::size_t{ 1 } << c };
+                try {
+                    Cache* local{ cache() };
+                    if ((local != nullptr) && (local->bytes + bytes <= settings().poolThreadBytes)) {
+                        Reclaiming guard;
+                        local->blocks[c].push_back(block);
+                        local->bytes += bytes;
+                        return;
+                    }
+                    give(block, c);
+                }
+                catch (...) {
+                    ::operator delete(block);
                 }
-                return *this;
-            }
-            template<typename RightExpr> auto operator &(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::LOR<T>, decltype(std::forward<RightExpr>(xi_expression))> {
-                return BinaryExpression<const Vector&, BinaryOperations::LOR<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
             }
 
-            // '^'/'^=' overload 
-            template<typename RightExpr> Vector& operator ^=(RightExpr&& xi_expression) {
-                for (std::size_t i{}; i < m_size; ++i) {
-                    m_data[i] ^= xi_expression[i];
+            // return all blocks cached by the shared pool and by the calling thread to the system (returns released bytes)
+            inline std::size_t trim() {
+                std::size_t released{};
+                const auto drain = [&released](std::vector<void*>* xo_blocks) {
+                    for (std::size_t c{}; c < Classes; ++c) {
+                        for (void* block : xo_blocks[c]) {
+                            ::operator delete(block);
+                            released += std::size_t{ 1 } << c;
+                        }
+                        xo_blocks[c].clear();
+                        xo_blocks[c].shrink_to_fit();
+                    }
+                };
+
+                if (Cache* local{ cache() }) {
+                    drain(local->blocks);
+                    local->bytes = 0;
                 }
-                return *this;
+
+                Shared& pool{ shared() };
+                std::lock_guard<std::mutex> lock(pool.mutex);
+                drain(pool.blocks);
+                pool.bytes = 0;
+                return released;
             }
-            template<typename RightExpr> auto operator ^(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::LXOR<T>, decltype(std::forward<RightExpr>(xi_expression))> {
-                return BinaryExpression<const Vector&, BinaryOperations::LXOR<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+
+            // read the pool counters
+            inline Statistics statistics() {
+                Statistics out;
+                out.hits = counters().hits.load(std::memory_order_relaxed);
+                out.sharedHits = counters().sharedHits.load(std::memory_order_relaxed);
+                out.misses = counters().misses.load(std::memory_order_relaxed);
+
+                Shared& pool{ shared() };
+                std::lock_guard<std::mutex> lock(pool.mutex);
+                out.cachedBytes = pool.bytes;
+                return out;
             }
 
-            // '<<'/'<<=' overload 
-            template<typename RightExpr> Vector& operator <<=(RightExpr&& xi_expression) {
-                for (std::size_t i{}; i < m_size; ++i) {
-                    m_data[i] <<= xi_expression[i];
-                }
-                return *this;
+            // zero the pool counters
+            inline void reset() noexcept {
+                counters().hits.store(0, std::memory_order_relaxed);
+                counters().sharedHits.store(0, std::memory_order_relaxed);
+                counters().misses.store(0, std::memory_order_relaxed);
             }
-            template<typename RightExpr> auto operator <<(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::SHL<T>, decltype(std::forward<RightExpr>(xi_expression))> {
-                return BinaryExpression<const Vector&, BinaryOperations::SHL<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+        };
+
+        // a memory pressure handler - releases memory and returns the amount of bytes released
+        using Handler = std::function<std::size_t()>;
+
+        // (handlers are shared, so that they are collected without allocating under the lock)
+        struct Handlers {
+            std::mutex mutex;
+            std::size_t next{};
+            std::vector<std::pair<std::size_t, std::shared_ptr<const Handler>>> handlers;
+        };
+
+        inline Handlers& handlers() {
+            static Handlers instance;
+            return instance;
+        }
+
+        // register a memory pressure handler (returns its identifier)
+        inline std::size_t subscribe(Handler xi_handler) {
+            Handlers& current{ handlers() };
+            auto handler{ std::make_shared<const Handler>(std::move(xi_handler)) };
+            std::lock_guard<std::mutex> lock(current.mutex);
+            current.handlers.emplace_back(current.next, std::move(handler));
+            return current.next++;
+        }
+
+        // remove a memory pressure handler
+        inline void unsubscribe(const std::size_t xi_identifier) {
+            Handlers& current{ handlers() };
+            std::lock_guard<std::mutex> lock(current.mutex);
+            current.handlers.erase(std::remove_if(current.handlers.begin(), current.handlers.end(),
+                                                  [xi_identifier](const std::pair<std::size_t, std::shared_ptr<const Handler>>& xi_entry) { return xi_entry.first == xi_identifier; }),
+                                   current.handlers.end());
+        }
+
+        /**
+        * \brief release memory - trims registered vectors (Footprint::trim with Settings::pressureWaste), returns the buffers cached by
+        *        the pool (shared and calling thread) and the calling thread scratch arena to the system and invokes all handlers.
+        *        no other thread may use a registered vector meanwhile.
+        *
+        * @param {size_t, out} amount of bytes released
+        **/
+        inline std::size_t pressure() {
+            std::size_t released{ Footprint::trim(settings().pressureWaste) };
+            released += Pool::trim();
+            if (Scratch::Arena& scratch{ Scratch::arena() }; scratch.depth() == 0) {
+                released += scratch.reserved();
+                scratch.release();
             }
 
-            // '>>'/'>>=' overload 
-            template<typename RightExpr> Vector& operator >>=(RightExpr&& xi_expression) {
-                for (std::size_t i{}; i < m_size; ++i) {
-                    m_data[i] >>= xi_expression[i];
+            // handlers are collected into storage reserved outside the lock (retrying if more were registered meanwhile)
+            std::vector<std::shared_ptr<const Handler>> current;
+            Handlers& registered{ handlers() };
+            for (std::size_t count{};;) {
+                current.reserve(count);
+                std::lock_guard<std::mutex> lock(registered.mutex);
+                if (registered.handlers.size() <= current.capacity()) {
+                    for (const auto& entry : registered.handlers) {
+                        current.push_back(entry.second);
+                    }
+                    break;
                 }
-                return *this;
+                count = registered.handlers.size();
             }
-            template<typename RightExpr> auto operator >>(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::SHR<T>, decltype(std::forward<RightExpr>(xi_expression))> {
-                return BinaryExpression<const Vector&, BinaryOperations::SHR<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            for (const std::shared_ptr<const Handler>& handler : current) {
+                released += (*handler)();
             }
 
-        // relational operator overload
+            return released;
+        }
+
+        /**
+        * \brief install a new handler which, whenever an allocation fails, returns the buffers cached by the pool and the calling thread
+        *        scratch arena to the system before retrying it. it runs on whichever thread failed an allocation, so it neither trims
+        *        registered vectors (which other threads may use) nor invokes handlers - that is left to explicit pressure() calls.
+        *        it throws std::bad_alloc if nothing was released, or if it is entered while the thread updates the pool caches (or itself).
+        **/
+        inline void install_new_handler() {
+            std::set_new_handler([]() {
+                if (reclaiming()) throw std::bad_alloc();
+                Reclaiming guard;
+
+                std::size_t released{ Pool::trim() };
+                if (Scratch::Arena& scratch{ Scratch::arena() }; scratch.depth() == 0) {
+                    released += scratch.reserved();
+                    scratch.release();
+                }
+                if (released == 0) throw std::bad_alloc();
+            });
+        }
+    };
+
+    /**
+    * \brief a cancellation request shared by its copies - a long running operation given a copy checks it between
+    *        units of work and stops early once cancel() was called (from any thread), or once its deadline passed:
+    *
+    *        Lazy::Cancellation timeout{ Lazy::Cancellation::after(std::chrono::milliseconds(50)) };
+    *        if (!Lazy::eval(c, a * b + a, timeout)) { ... (c is partially evaluated) }
+    **/
+    class Cancellation {
         public:
+            using Clock = std::chrono::steady_clock;
 
-            // '=='
-            template<typename RightExpr> auto operator ==(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::EQ<T>, decltype(std::forward<RightExpr>(xi_expression))> {
-                return BinaryExpression<const Vector&, BinaryOperations::EQ<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+        // shared state
+        struct State {
+            std::atomic<bool> cancelled{ false };
+            Clock::time_point deadline{ Clock::time_point::max() };     // (fixed once constructed)
+        };
+
+        // properties
+        private:
+            std::shared_ptr<State> m_state{ std::make_shared<State>() };
+
+        // constructors
+        public:
+            Cancellation() = default;
+
+            // a cancellation which expires at a deadline
+            explicit Cancellation(const Clock::time_point xi_deadline) {
+                m_state->deadline = xi_deadline;
             }
 
-            // '!='
-            template<typename RightExpr> auto operator !=(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::NEQ<T>, decltype(std::forward<RightExpr>(xi_expression))> {
-                return BinaryExpression<const Vector&, BinaryOperations::NEQ<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            // a cancellation which expires once a given duration elapsed (from now)
+            template<typename Rep, typename Period> static Cancellation after(const std::chrono::duration<Rep, Period> xi_timeout) {
+                return Cancellation(Clock::now() + std::chrono::duration_cast<Clock::duration>(xi_timeout));
             }
 
-            // '<'
-            template<typename RightExpr> auto operator <(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::LT<T>, decltype(std::forward<RightExpr>(xi_expression))> {
-                return BinaryExpression<const Vector&, BinaryOperations::LT<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+        // operations
+        public:
+            void cancel() noexcept { m_state->cancelled.store(true, std::memory_order_relaxed); }
+
+            // was cancel() called, or did the deadline pass? (the clock is read only while a deadline is pending)
+            bool cancelled() const noexcept {
+                State& state{ *m_state };
+                if (state.cancelled.load(std::memory_order_relaxed)) return true;
+                if ((state.deadline == Clock::time_point::max()) || (Clock::now() < state.deadline)) return false;
+
+                state.cancelled.store(true, std::memory_order_relaxed);
+                return true;
             }
 
-            // '<='
-            template<typename RightExpr> auto operator <=(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::LE<T>, decltype(std::forward<RightExpr>(xi_expression))> {
-                return BinaryExpression<const Vector&, BinaryOperations::LE<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            Clock::time_point deadline() const noexcept { return m_state->deadline; }
+    };
+
+    /**
+    * asynchronous evaluation - Lazy::async_eval queues an assignment on a background executor and returns a future.
+    * the destination and the operands of a queued assignment are marked pending: reading the destination (data(), iteration,
+    * another evaluation reading it) waits for the assignment to complete, and modifying the destination or an operand
+    * (non const data() or iteration, evaluations, modifiers, destruction) waits for it as well. element access ([], at, front, back)
+    * does not wait, so that it remains cheap - debug builds assert that it does not touch a pending vector. queued assignments are executed in submission order, one at a time
+    * (each of them in parallel if it is long enough). a vector with pending assignments should only be used by the thread
+    * which queued them.
+    **/
+    namespace Async {
+
+        /**
+        * \brief background executor - runs submitted jobs in submission order on a single thread
+        **/
+        class Executor {
+            // properties
+            private:
+                std::mutex m_mutex;
+                std::condition_variable m_wake;
+                std::deque<std::function<void()>> m_jobs;
+                bool m_stop{ false };
+                std::thread m_thread;
+
+                void loop() {
+                    running() = true;
+                    for (;;) {
+                        std::function<void()> job;
+                        {
+                            std::unique_lock<std::mutex> lock(m_mutex);
+                            m_wake.wait(lock, [this]() { return m_stop || !m_jobs.empty(); });
+                            if (m_jobs.empty()) return;
+                            job = std::move(m_jobs.front());
+                            m_jobs.pop_front();
+                        }
+                        job();
+                    }
+                }
+
+            // constructors
+            public:
+                Executor() : m_thread([this]() { loop(); }) {}
+
+                // queued jobs are executed before the executor is destroyed
+                ~Executor() {
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_stop = true;
+                    }
+                    m_wake.notify_one();
+                    m_thread.join();
+                }
+
+                Executor(const Executor&) = delete;
+                Executor& operator=(const Executor&) = delete;
+
+            // operations
+            public:
+                void submit(std::function<void()> xi_job) {
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_jobs.push_back(std::move(xi_job));
+                    }
+                    m_wake.notify_one();
+                }
+
+                // is the calling thread the executor thread?
+                static bool& running() noexcept {
+                    thread_local bool flag{ false };
+                    return flag;
+                }
+        };
+
+        inline Executor& executor() {
+            static Executor instance;
+            return instance;
+        }
+
+        // access to vector pending evaluation state (used by the evaluator and async_eval)
+        struct Access {
+            // wait for a pending assignment writing a vector
+            template<typename T> static void readable(const Vector<T>& xi_vector) {
+                xi_vector.readable();
             }
 
-            // '>'
-            template<typename RightExpr> auto operator >(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::GT<T>, decltype(std::forward<RightExpr>(xi_expression))> {
-                return BinaryExpression<const Vector&, BinaryOperations::GT<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            // mark a vector as accessed by a queued assignment
+            template<typename T> static void pend(const Vector<T>& xi_vector, const std::shared_future<void>& xi_future, const bool xi_write) {
+                xi_vector.pend(xi_future, xi_write);
             }
 
-            // '>='
-            template<typename RightExpr> auto operator >=(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::GE<T>, decltype(std::forward<RightExpr>(xi_expression))> {
-                return BinaryExpression<const Vector&, BinaryOperations::GE<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            // buffer of a vector about to be written by a queued assignment (summaries and trackers are notified, without waiting)
+            template<typename T> static T* target(Vector<T>& xi_vector) {
+                xi_vector.changed(0, std::numeric_limits<std::size_t>::max());
+                return xi_vector.m_data;
             }
+        };
+
+        // wait for pending assignments writing any vector an expression reads
+        template<typename Expression> void readable(const Expression& xi_expression) {
+            ExpressionTraits::for_each_leaf(xi_expression, [](const auto& xi_leaf) { Access::readable(xi_leaf); });
+        }
+    };
+
+    /**
+    * execution policies - select per call how an evaluation, reduction, scan, sort or fill is executed
+    * (instead of the evaluator choice), mirroring the standard execution policies:
+    * > seq - a single thread, a plain loop.
+    * > unseq - a single thread, loops hinted as vectorizable (and tiled evaluation of wide expressions).
+    * > par - split lazily on the work stealing scheduler (Evaluation::scheduler), plain loops per chunk.
+    * > par_unseq - split lazily on the work stealing scheduler, vectorizable loops per chunk.
+    * when LAZY_VECTOR_STD_EXECUTION is defined, the standard policies (std::execution::seq, ...) are accepted as well.
+    **/
+    namespace Execution {
+
+        struct Sequenced {};
+        struct Unsequenced {};
+        struct Parallel {};
+        struct ParallelUnsequenced {};
+
+        inline constexpr Sequenced seq{};
+        inline constexpr Unsequenced unseq{};
+        inline constexpr Parallel par{};
+        inline constexpr ParallelUnsequenced par_unseq{};
+
+        // policy properties
+        template<typename Policy> struct Traits {
+            static constexpr bool policy{ false };
+            static constexpr bool parallel{ false };
+            static constexpr bool vectorized{ false };
+        };
+
+        template<bool Parallel, bool Vectorized> struct Properties {
+            static constexpr bool policy{ true };
+            static constexpr bool parallel{ Parallel };
+            static constexpr bool vectorized{ Vectorized };
+        };
+
+        template<> struct Traits<Sequenced> : Properties<false, false> {};
+        template<> struct Traits<Unsequenced> : Properties<false, true> {};
+        template<> struct Traits<Parallel> : Properties<true, false> {};
+        template<> struct Traits<ParallelUnsequenced> : Properties<true, true> {};
+#if defined(LAZY_VECTOR_STD_EXECUTION)
+        template<> struct Traits<std::execution::sequenced_policy> : Properties<false, false> {};
+        template<> struct Traits<std::execution::parallel_policy> : Properties<true, false> {};
+        template<> struct Traits<std::execution::parallel_unsequenced_policy> : Properties<true, true> {};
+#if __cplusplus > 201703L
+        template<> struct Traits<std::execution::unsequenced_policy> : Properties<false, true> {};
+#endif
+#endif
+
+        // is a type an execution policy?
+        template<typename Policy> constexpr bool is_policy() {
+            return Traits<typename std::decay<Policy>::type>::policy;
+        }
     };
+
+    /**
+    * evaluation strategies - all vector assignments (and compound assignments) are evaluated through Evaluation::evaluate,
+    * which chooses (using the ExpressionTraits::Cost model) between:
+    * > fused - a single loop evaluating the entire expression tree per position.
+    * > vectorized - a fused loop hinted as free of loop carried dependencies (chosen for vectorizable expressions).
+    * > tiled - wide/deep expressions are evaluated over small (L1 resident) tiles; sub expressions are evaluated into scratch tiles
+    *           and then combined, so each loop reads only a few memory streams and keeps only a few values in registers.
+    * > parallel - long expressions are split lazily into chunks evaluated on a work stealing scheduler (so uneven per element costs
+    *              are balanced), each chunk is evaluated fused, vectorized or tiled. disabled by default (Settings::threads is 1).
+    **/
+    namespace Evaluation {
+
+        // evaluation strategy
+        enum class Strategy { Automatic, Fused, Vectorized, Tiled, Parallel };
+
+        // evaluation settings
+        struct Settings {
+            Strategy strategy{ Strategy::Automatic };   // forced strategy (Automatic lets the evaluator choose)
+            std::size_t tileBytes{ 4096 };              // size of a single scratch tile
+            std::size_t tiledStreams{ 12 };             // expressions reading at least this amount of vector operands are tiled...
+            std::size_t tiledDepth{ 5 };                // ...as well as expressions at least this deep
+            std::size_t narrowStreams{ 4 };             // sub expressions reading up to this amount of vector operands are evaluated fused into a tile
+            std::size_t threads{ 1 };                   // threads used by parallel evaluation (0 - hardware concurrency, 1 - no parallel evaluation)
+            std::size_t parallelWork{ 1 << 18 };        // expressions whose work (length * Cost::work) is below this are never evaluated in parallel
+                                                        // (nor split to chunks of less than a quarter of it)
+        };
+
+        inline Settings& settings() noexcept {
+            static Settings instance;
+            return instance;
+        }
+
+        // amount of threads used by parallel evaluation
+        inline std::size_t concurrency() noexcept {
+            const std::size_t threads{ settings().threads };
+            return (threads > 0) ? threads : std::max<std::size_t>(1, std::thread::hardware_concurrency());
+        }
+
+        /**
+        * \brief a work stealing thread pool - every worker owns a deque of tasks, it pushes and pops tasks at its back (most recent,
+        *        cache warm tasks first) and when it runs out of tasks it steals from the front of other deques (oldest tasks first).
+        *        tasks spawned by other threads are distributed round robin. a thread waiting for tasks (help_until) executes tasks
+        *        meanwhile, so tasks may wait for tasks they spawned. tasks should not throw.
+        *        used by parallel evaluation (run, splitting ranges lazily) and by task groups.
+        **/
+        class Scheduler {
+            public:
+                using Task = std::function<void()>;
+
+            // properties
+            private:
+                struct alignas(64) Queue {
+                    std::mutex mutex;
+                    std::deque<Task> tasks;
+                    std::atomic<std::size_t> size{};            // amount of tasks (read without locking)
+                };
+
+                // state of a range executed by run
+                template<typename Function> struct Range {
+                    Function& function;
+                    const std::size_t grain;
+                    const Cancellation* cancellation;           // (optional) checked before every grain
+                    const std::size_t helpers;                  // most split off parts executing at a time (allowed threads - 1)
+                    std::atomic<bool> stopped{ false };         // were grains skipped due to cancellation?
+                    std::atomic<std::size_t> pending{};         // split off parts not yet executed
+                    std::atomic<bool> failed{ false };
+                    std::exception_ptr error{};                 // first exception thrown by function (guarded by failed)
+
+                    // reserve a split off part, unless as many parts as allowed are already pending
+                    bool split() noexcept {
+                        std::size_t current{ pending.load() };
+                        while (current < helpers) {
+                            if (pending.compare_exchange_weak(current, current + 1)) return true;
+                        }
+                        return false;
+                    }
+                };
+
+                std::vector<std::unique_ptr<Queue>> m_queues;   // one per worker, and one shared by other threads
+                std::vector<std::thread> m_workers;
+                std::mutex m_mutex;                             // guards sleeping
+                std::condition_variable m_wake;                 // signals a spawned or a completed task (or termination)
+                std::atomic<std::size_t> m_queued{};            // tasks not yet claimed
+                std::atomic<std::size_t> m_sleeping{};          // threads waiting on m_wake
+                std::atomic<std::size_t> m_next{};              // round robin position for tasks spawned by other threads
+                bool m_stop{ false };
+
+                // scheduler and queue of the calling thread (queue index is valid only if the scheduler is this one)
+                static std::pair<const Scheduler*, std::size_t>& local() noexcept {
+                    thread_local std::pair<const Scheduler*, std::size_t> identity{ nullptr, 0 };
+                    return identity;
+                }
+
+            // internal methods
+            private:
+
+                // is the calling thread one of this scheduler workers?
+                bool worker() const noexcept {
+                    return local().first == this;
+                }
+
+                // claim a task - from the back of the own queue, otherwise from the front of another
+                bool claim(Task& xo_task) {
+                    const std::size_t queues{ m_queues.size() },
+                                      own{ worker() ? local().second : queues - 1 };
+                    for (std::size_t i{}; i < queues; ++i) {
+                        Queue& queue{ *m_queues[(own + i) % queues] };
+                        std::lock_guard<std::mutex> lock(queue.mutex);
+                        if (queue.tasks.empty()) continue;
+
+                        if (i == 0) {
+                            xo_task = std::move(queue.tasks.back());
+                            queue.tasks.pop_back();
+                        }
+                        else {
+                            xo_task = std::move(queue.tasks.front());
+                            queue.tasks.pop_front();
+                        }
+                        queue.size.store(queue.tasks.size(), std::memory_order_relaxed);
+                        m_queued.fetch_sub(1);
+                        return true;
+                    }
+                    return false;
+                }
+
+                // execute a task, and wake sleeping threads which might wait for it
+                void execute(Task& xi_task) {
+                    xi_task();
+                    xi_task = nullptr;
+                    if (m_sleeping.load() > 0) {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_wake.notify_all();
+                    }
+                }
+
+                // is there nothing left for idle threads to steal? (the calling worker queue is empty, or nothing is queued at all)
+                bool starving() const noexcept {
+                    if (m_workers.empty()) return false;
+                    return worker() ? (m_queues[local().second]->size.load(std::memory_order_relaxed) == 0) : (m_queued.load() == 0);
+                }
+
+                // execute a range grain by grain, splitting off the upper half of the remaining range whenever other threads are starving
+                // (and the range is executed by fewer threads than allowed)
+                template<typename Function> void execute(Range<Function>& xio_range, std::size_t xi_first, std::size_t xi_last) {
+                    try {
+                        while ((xi_first < xi_last) && !xio_range.failed.load(std::memory_order_relaxed)) {
+                            if ((xio_range.cancellation != nullptr) && xio_range.cancellation->cancelled()) {
+                                xio_range.stopped.store(true);
+                                return;
+                            }
+
+                            if ((xi_last - xi_first > xio_range.grain) && starving() && xio_range.split()) {
+                                const std::size_t grains{ (xi_last - xi_first + xio_range.grain - 1) / xio_range.grain },
+                                                  middle{ xi_first + (grains / 2) * xio_range.grain },
+                                                  last{ xi_last };
+                                spawn([this, &xio_range, middle, last]() {
+                                    execute(xio_range, middle, last);
+
+                                    // last access of the range (the issuing thread may return once no part is pending)
+                                    xio_range.pending.fetch_sub(1);
+                                });
+                                xi_last = middle;
+                                continue;
+                            }
+
+                            const std::size_t next{ std::min(xi_first + xio_range.grain, xi_last) };
+                            xio_range.function(xi_first, next);
+                            xi_first = next;
+                        }
+                    }
+                    catch (...) {
+                        if (!xio_range.failed.exchange(true)) {
+                            xio_range.error = std::current_exception();
+                        }
+                    }
+                }
+
+                void loop(const std::size_t xi_index) {
+                    local() = { this, xi_index };
+                    Task task;
+                    for (;;) {
+                        if (claim(task)) {
+                            execute(task);
+                            continue;
+                        }
+
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        m_sleeping.fetch_add(1);
+                        m_wake.wait(lock, [this]() { return m_stop || (m_queued.load() > 0); });
+                        m_sleeping.fetch_sub(1);
+                        if (m_stop) return;
+                    }
+                }
+
+            // constructors
+            public:
+                explicit Scheduler(const std::size_t xi_workers) {
+                    for (std::size_t i{}; i <= xi_workers; ++i) {
+                        m_queues.push_back(std::make_unique<Queue>());
+                    }
+                    m_workers.reserve(xi_workers);
+                    for (std::size_t i{}; i < xi_workers; ++i) {
+                        m_workers.emplace_back([this, i]() { loop(i); });
+                    }
+                }
+
+                ~Scheduler() {
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_stop = true;
+                    }
+                    m_wake.notify_all();
+                    for (std::thread& worker : m_workers) {
+                        worker.join();
+                    }
+                }
+
+                Scheduler(const Scheduler&) = delete;
+                Scheduler& operator=(const Scheduler&) = delete;
+
+            // queries
+            public:
+                std::size_t workers() const noexcept { return m_workers.size(); }
+
+                // is the calling thread a worker of any scheduler?
+                static bool executing() noexcept { return local().first != nullptr; }
+
+            // operations
+            public:
+
+                // queue a task (on the calling worker queue, or round robin for other threads)
+                void spawn(Task xi_task) {
+                    const std::size_t index{ worker() ? local().second : m_next.fetch_add(1) % m_queues.size() };
+                    {
+                        Queue& queue{ *m_queues[index] };
+                        std::lock_guard<std::mutex> lock(queue.mutex);
+                        queue.tasks.push_back(std::move(xi_task));
+                        queue.size.store(queue.tasks.size(), std::memory_order_relaxed);
+                    }
+                    m_queued.fetch_add(1);
+                    if (m_sleeping.load() > 0) {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_wake.notify_one();
+                    }
+                }
+
+                /**
+                * \brief execute tasks until a condition holds (the condition has to become true by tasks completion)
+                *
+                * @param {Condition, in} function returning true once waiting is over
+                **/
+                template<typename Condition> void help_until(Condition&& xi_done) {
+                    Task task;
+                    while (!xi_done()) {
+                        if (claim(task)) {
+                            execute(task);
+                            continue;
+                        }
+
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        m_sleeping.fetch_add(1);
+                        m_wake.wait(lock, [&]() { return xi_done() || (m_queued.load() > 0); });
+                        m_sleeping.fetch_sub(1);
+                    }
+                }
+
+                // wake threads waiting in help_until to re-check their condition (for conditions which are not changed by tasks)
+                void notify() {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_wake.notify_all();
+                }
+
+                /**
+                * \brief execute a function over a range split lazily (lazy binary splitting) - the calling thread executes the range
+                *        grain by grain, and before every grain, if idle threads have nothing to steal, it splits off the upper half of
+                *        its remaining range as a task (which is split the same way by the thread stealing it). uneven per element costs
+                *        are balanced by stealing, while evenly loaded ranges are split only a few times per thread. at most the given amount
+                *        of threads (by default concurrency(), i.e. Settings::threads) execute the range at a time, and no more than the workers
+                *        and the calling thread.
+                *        returns once the whole range was executed, rethrowing the first exception the function threw (the remaining grains
+                *        are skipped once a grain threw). given a cancellation, it is checked before every grain and remaining grains are skipped
+                *        once it was cancelled.
+                *
+                * @param {size_t,       in}  first position
+                * @param {size_t,       in}  last position (not included)
+                * @param {size_t,       in}  grain - smallest part executed by a single invocation (split points are multiples of it from first)
+                * @param {Function,     in}  function(first, last)
+                * @param {Cancellation, in}  cancellation (optional)
+                * @param {size_t,       in}  most threads executing the range at a time (0 - concurrency())
+                * @param {bool,         out} was the whole range executed? (false if grains were skipped due to cancellation)
+                **/
+                template<typename Function> bool run(const std::size_t xi_first, const std::size_t xi_last, const std::size_t xi_grain, Function&& xi_function,
+                                                     const Cancellation* xi_cancellation = nullptr, const std::size_t xi_threads = 0) {
+                    const std::size_t grain{ std::max<std::size_t>(1, xi_grain) },
+                                      threads{ (xi_threads > 0) ? xi_threads : concurrency() },
+                                      helpers{ std::min(m_workers.size(), threads - 1) };
+                    if (xi_last <= xi_first) return true;
+                    if ((xi_cancellation == nullptr) && ((xi_last <= xi_first + grain) || (helpers == 0))) {
+                        xi_function(xi_first, xi_last);
+                        return true;
+                    }
+
+                    Range<Function> range{ xi_function, grain, xi_cancellation, helpers };
+                    execute(range, xi_first, xi_last);
+                    help_until([&range]() { return range.pending.load() == 0; });
+                    if (range.failed.load()) std::rethrow_exception(range.error);
+                    return !range.stopped.load();
+                }
+        };
+
+        // work stealing scheduler used by parallel evaluation and task groups - created on first use with hardware concurrency threads
+        // (including the calling thread), or Settings::threads if it is larger at that point
+        inline Scheduler& scheduler() {
+            static Scheduler instance(std::max<std::size_t>({ 1, std::thread::hardware_concurrency(), concurrency() }) - 1);
+            return instance;
+        }
+
+        // amount of threads used by parallel execution policies (all the scheduler workers and the calling thread - Settings::threads
+        // bounds only the automatic strategy)
+        inline std::size_t policy_concurrency() {
+            return scheduler().workers() + 1;
+        }
+
+        /**
+        * \brief evaluate an expression in a single loop
+        *
+        * @param {Assign,     in}  assignment operation (AssignOperations)
+        * @param {T*,         out} destination
+        * @param {Expression, in}  expression
+        * @param {size_t,     in}  first position
+        * @param {size_t,     in}  last position (not included)
+        **/
+        template<typename Assign, typename T, typename Expression> void fused(T* xo_destination, const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_last) {
+            for (std::size_t i{ xi_first }; i < xi_last; ++i) {
+                Assign::apply(xo_destination[i], Operands::at(xi_expression, i));
+            }
+        }
+
+        // evaluate an expression in a single loop, hinted as vectorizable (no dependencies between iterations)
+        template<typename Assign, typename T, typename Expression> void vectorized(T* xo_destination, const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_last) {
+            LAZY_VECTOR_VECTORIZE
+            for (std::size_t i{ xi_first }; i < xi_last; ++i) {
+                Assign::apply(xo_destination[i], Operands::at(xi_expression, i));
+            }
+        }
+
+        // tiled evaluation internals
+        namespace Tiling {
+
+            // amount of scratch tiles needed to evaluate an expression
+            template<typename Expression> constexpr std::size_t scratch_tiles() {
+                return 2 * ExpressionTraits::Tree<Expression>::depth;
+            }
+
+            // should a sub expression be evaluated as a whole (in a single fused loop)?
+            template<typename Expression> bool narrow() {
+                return !ExpressionTraits::IsExpression<Expression>::value ||
+                       (ExpressionTraits::Tree<Expression>::streams <= settings().narrowStreams);
+            }
+
+            template<typename Assign, typename T, typename Expression> void fill(T* xo_out, const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_count, T* xi_scratch);
+
+            // evaluate an operand of a decomposed expression node over a tile - vector and scalar operands are read in place,
+            // other operands are evaluated into the scratch tile (advancing scratch pointer)
+            template<typename T, typename Operand, typename Function> void with_operand(const Operand& xi_operand, const std::size_t xi_first, const std::size_t xi_count,
+                                                                                        T*& xio_scratch, Function&& xi_function) {
+                if constexpr (ExpressionTraits::IsExpression<Operand>::value) {
+                    T* values{ xio_scratch };
+                    xio_scratch += xi_count;
+                    fill<AssignOperations::ASSIGN>(values, xi_operand, xi_first, xi_count, xio_scratch);
+                    xi_function([values](const std::size_t j) -> const T& { return values[j]; });
+                }
+                else {
+                    xi_function([&xi_operand, xi_first](const std::size_t j) -> decltype(auto) { return Operands::at(xi_operand, xi_first + j); });
+                }
+            }
+
+            /**
+            * \brief evaluate an expression over positions [first, first + count) into a tile
+            *
+            * @param {Assign,     in}     assignment operation (AssignOperations)
+            * @param {T*,         out}    tile (position first is written to tile[0])
+            * @param {Expression, in}     expression
+            * @param {size_t,     in}     first position
+            * @param {size_t,     in}     amount of positions
+            * @param {T*,         in|out} scratch tiles
+            **/
+            template<typename Assign, typename T, typename Expression> void fill(T* xo_out, const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_count, T* xi_scratch) {
+                if constexpr (ExpressionTraits::IsExpression<Expression>::value) {
+                    if (!narrow<Expression>()) {
+                        using Op = typename ExpressionTraits::Operation<Expression>::type;
+                        T* scratch{ xi_scratch };
+                        with_operand<T>(xi_expression.le(), xi_first, xi_count, scratch, [&](auto&& left) {
+                            with_operand<T>(xi_expression.re(), xi_first, xi_count, scratch, [&](auto&& right) {
+                                for (std::size_t j{}; j < xi_count; ++j) {
+                                    Assign::apply(xo_out[j], Op::apply(left(j), right(j)));
+                                }
+                            });
+                        });
+                        return;
+                    }
+                }
+
+                for (std::size_t j{}; j < xi_count; ++j) {
+                    Assign::apply(xo_out[j], Operands::at(xi_expression, xi_first + j));
+                }
+            }
+        };
+
+        // can an expression be tiled into a destination of a given type?
+        template<typename T, typename Expression> constexpr bool tileable() {
+            return ExpressionTraits::IsExpression<Expression>::value && ExpressionTraits::Homogeneous<T, Expression>::value;
+        }
+
+        // amount of positions in a tile
+        template<typename T> std::size_t tile_size() {
+            return std::max<std::size_t>(16, (settings().tileBytes / sizeof(T)) & ~std::size_t{ 15 });
+        }
+
+        /**
+        * \brief evaluate an expression over cache resident tiles
+        *
+        * @param {Assign,     in}  assignment operation (AssignOperations)
+        * @param {T*,         out} destination
+        * @param {Expression, in}  expression
+        * @param {size_t,     in}  first position
+        * @param {size_t,     in}  last position (not included)
+        **/
+        template<typename Assign, typename T, typename Expression> void tiled(T* xo_destination, const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_last) {
+            if constexpr (!tileable<T, Expression>()) {
+                fused<Assign>(xo_destination, xi_expression, xi_first, xi_last);
+            }
+            else {
+                const std::size_t tile{ tile_size<T>() };
+                Scratch::Scope scope;
+                Scratch::Array<T> scratch(tile * Tiling::scratch_tiles<Expression>());
+
+                for (std::size_t first{ xi_first }; first < xi_last; first += tile) {
+                    const std::size_t count{ std::min(tile, xi_last - first) };
+                    Tiling::fill<Assign>(xo_destination + first, xi_expression, first, count, scratch.data());
+                }
+            }
+        }
+
+        // choose single threaded evaluation strategy for an expression
+        template<typename T, typename Expression> Strategy choose_serial(const std::size_t xi_length) {
+            using Model = ExpressionTraits::Cost<T, Expression>;
+            const Settings& current{ settings() };
+            if ((current.strategy == Strategy::Fused) || (current.strategy == Strategy::Vectorized)) {
+                return current.strategy;
+            }
+
+            if constexpr (tileable<T, Expression>()) {
+                const bool wide{ (Model::streams >= current.tiledStreams) || (Model::depth >= current.tiledDepth) };
+                if ((current.strategy == Strategy::Tiled) || (wide && (xi_length >= 2 * tile_size<T>()))) {
+                    return Strategy::Tiled;
+                }
+            }
+
+            return Model::vectorizable ? Strategy::Vectorized : Strategy::Fused;
+        }
+
+        // is an expression worth evaluating in parallel?
+        template<typename T, typename Expression> bool parallelizable(const std::size_t xi_length) {
+            const Settings& current{ settings() };
+            return (concurrency() > 1) && (xi_length * ExpressionTraits::Cost<T, Expression>::work >= current.parallelWork);
+        }
+
+        // choose evaluation strategy for an expression
+        template<typename T, typename Expression> Strategy choose(const std::size_t xi_length) {
+            const Settings& current{ settings() };
+            if ((current.strategy == Strategy::Parallel) || ((current.strategy == Strategy::Automatic) && parallelizable<T, Expression>(xi_length))) {
+                return Strategy::Parallel;
+            }
+            return choose_serial<T, Expression>(xi_length);
+        }
+
+        // evaluate an expression on the calling thread
+        template<typename Assign, typename T, typename Expression> void serial(T* xo_destination, const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_last) {
+            switch (choose_serial<T, Expression>(xi_last - xi_first)) {
+                case Strategy::Tiled:
+                    tiled<Assign>(xo_destination, xi_expression, xi_first, xi_last);
+                    break;
+                case Strategy::Vectorized:
+                    vectorized<Assign>(xo_destination, xi_expression, xi_first, xi_last);
+                    break;
+                default:
+                    fused<Assign>(xo_destination, xi_expression, xi_first, xi_last);
+                    break;
+            }
+        }
+
+        // smallest part of a range evaluated by a single thread - a multiple of 64 elements, holding at least a quarter of Settings::parallelWork
+        template<typename T, typename Expression> std::size_t grain() {
+            const std::size_t minimal{ std::max<std::size_t>(64, settings().parallelWork / (4 * ExpressionTraits::Cost<T, Expression>::work)) };
+            return (minimal + 63) & ~std::size_t{ 63 };
+        }
+
+        /**
+        * \brief evaluate an expression in parallel - the range is split lazily on the work stealing scheduler (Scheduler::run),
+        *        so threads which finished their part steal from threads evaluating expensive elements
+        *
+        * @param {Assign,     in}  assignment operation (AssignOperations)
+        * @param {T*,         out} destination
+        * @param {Expression, in}  expression
+        * @param {size_t,     in}  first position
+        * @param {size_t,     in}  last position (not included)
+        **/
+        template<typename Assign, typename T, typename Expression> void parallel(T* xo_destination, const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_last) {
+            scheduler().run(xi_first, xi_last, grain<T, Expression>(), [&](const std::size_t xi_from, const std::size_t xi_to) {
+                serial<Assign>(xo_destination, xi_expression, xi_from, xi_to);
+            });
+        }
+
+        // execute an evaluation of a given length, reporting it to statistics, profiling and hardware counters (when enabled)
+        template<typename Assign, typename T, typename E, typename Function> void measured(const std::size_t xi_length, Function&& xi_function) {
+#if defined(LAZY_VECTOR_STATISTICS) || defined(LAZY_VECTOR_PROFILING)
+            const auto start{ std::chrono::steady_clock::now() };
+#endif
+#if defined(LAZY_VECTOR_PERF_COUNTERS)
+            const HardwareCounters::Sample before{ HardwareCounters::read() };
+#endif
+            xi_function();
+            (void)xi_length;
+#if defined(LAZY_VECTOR_STATISTICS) || defined(LAZY_VECTOR_PROFILING)
+            const auto end{ std::chrono::steady_clock::now() };
+#endif
+#if defined(LAZY_VECTOR_STATISTICS)
+            Statistics::evaluation<Assign, T, E>(xi_length, static_cast<std::size_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+#endif
+#if defined(LAZY_VECTOR_PROFILING)
+            Profiling::expression<E>(Profiling::attributed(), Assign::symbol, start, end, xi_length);
+#endif
+#if defined(LAZY_VECTOR_PERF_COUNTERS)
+            HardwareCounters::expression<E>(Assign::symbol, before, HardwareCounters::read(), xi_length);
+#endif
+        }
+
+        /**
+        * \brief evaluate an expression into a destination, using the most suitable strategy
+        *
+        * @param {Assign,     in}  assignment operation (AssignOperations)
+        * @param {T*,         out} destination
+        * @param {Expression, in}  expression
+        * @param {size_t,     in}  first position
+        * @param {size_t,     in}  last position (not included)
+        **/
+        template<typename Assign, typename T, typename Expression> void run(T* xo_destination, const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_last) {
+            using E = typename std::decay<Expression>::type;
+            measured<Assign, T, E>(xi_last - xi_first, [&]() {
+                switch (choose<T, E>(xi_last - xi_first)) {
+                    case Strategy::Parallel:
+                        parallel<Assign>(xo_destination, xi_expression, xi_first, xi_last);
+                        break;
+                    case Strategy::Tiled:
+                        tiled<Assign>(xo_destination, xi_expression, xi_first, xi_last);
+                        break;
+                    case Strategy::Vectorized:
+                        vectorized<Assign>(xo_destination, xi_expression, xi_first, xi_last);
+                        break;
+                    default:
+                        fused<Assign>(xo_destination, xi_expression, xi_first, xi_last);
+                        break;
+                }
+            });
+        }
+
+        /**
+        * \brief evaluate an expression into a destination with a given execution policy (Lazy::Execution)
+        *        > sequenced - a single fused loop.
+        *        > unsequenced - a single thread, vectorized or tiled (as chosen by the cost model).
+        *        > parallel - split lazily on the work stealing scheduler, chunks are evaluated in fused loops.
+        *        > parallel unsequenced - split lazily on the work stealing scheduler, chunks are vectorized or tiled.
+        *
+        * @param {Policy,     in}  execution policy
+        * @param {Assign,     in}  assignment operation (AssignOperations)
+        * @param {T*,         out} destination
+        * @param {Expression, in}  expression
+        * @param {size_t,     in}  first position
+        * @param {size_t,     in}  last position (not included)
+        **/
+        template<typename Policy, typename Assign, typename T, typename Expression> void run(T* xo_destination, const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_last) {
+            using E = typename std::decay<Expression>::type;
+            const auto chunk = [&](const std::size_t xi_from, const std::size_t xi_to) {
+                if constexpr (Execution::Traits<Policy>::vectorized) {
+                    serial<Assign>(xo_destination, xi_expression, xi_from, xi_to);
+                }
+                else {
+                    fused<Assign>(xo_destination, xi_expression, xi_from, xi_to);
+                }
+            };
+
+            measured<Assign, T, E>(xi_last - xi_first, [&]() {
+                if constexpr (Execution::Traits<Policy>::parallel) {
+                    scheduler().run(xi_first, xi_last, grain<T, E>(), chunk, nullptr, policy_concurrency());
+                }
+                else {
+                    chunk(xi_first, xi_last);
+                }
+            });
+        }
+
+        // execute [first, last) in grain sized chunks (distributed on the work stealing scheduler over at most the given amount of
+        // threads, serially if it is 1), checking a cancellation before every chunk. returns false if chunks were skipped due to cancellation
+        template<typename T, typename Expression, typename Chunk> bool chunked(const std::size_t xi_threads, const std::size_t xi_first, const std::size_t xi_last,
+                                                                              const Cancellation& xi_cancellation, Chunk&& xi_chunk) {
+            const std::size_t size{ grain<T, typename std::decay<Expression>::type>() };
+            if (xi_threads > 1) {
+                return scheduler().run(xi_first, xi_last, size, xi_chunk, &xi_cancellation, xi_threads);
+            }
+
+            for (std::size_t first{ xi_first }; first < xi_last; first += size) {
+                if (xi_cancellation.cancelled()) return false;
+                xi_chunk(first, std::min(xi_last, first + size));
+            }
+            return true;
+        }
+
+        /**
+        * \brief evaluate an expression into a destination unless cancelled (using the most suitable strategy, as run) - the range is
+        *        evaluated in grain sized chunks and the cancellation is checked before every chunk. a cancelled evaluation leaves every
+        *        chunk of the destination either fully evaluated or untouched (chunks evaluated in parallel need not form a prefix).
+        *
+        * @param {Assign,       in}  assignment operation (AssignOperations)
+        * @param {T*,           out} destination
+        * @param {Expression,   in}  expression
+        * @param {size_t,       in}  first position
+        * @param {size_t,       in}  last position (not included)
+        * @param {Cancellation, in}  cancellation
+        * @param {bool,         out} was the whole range evaluated?
+        **/
+        template<typename Assign, typename T, typename Expression> bool run(T* xo_destination, const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_last,
+                                                                            const Cancellation& xi_cancellation) {
+            using E = typename std::decay<Expression>::type;
+            bool completed{ false };
+            measured<Assign, T, E>(xi_last - xi_first, [&]() {
+                completed = chunked<T, E>((choose<T, E>(xi_last - xi_first) == Strategy::Parallel) ? concurrency() : 1, xi_first, xi_last, xi_cancellation,
+                                          [&](const std::size_t xi_from, const std::size_t xi_to) { serial<Assign>(xo_destination, xi_expression, xi_from, xi_to); });
+            });
+            return completed;
+        }
+
+        // evaluate an expression into a destination with a given execution policy unless cancelled (as the above)
+        template<typename Policy, typename Assign, typename T, typename Expression> bool run(T* xo_destination, const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_last,
+                                                                                             const Cancellation& xi_cancellation) {
+            using E = typename std::decay<Expression>::type;
+            bool completed{ false };
+            measured<Assign, T, E>(xi_last - xi_first, [&]() {
+                completed = chunked<T, E>(Execution::Traits<Policy>::parallel ? policy_concurrency() : 1, xi_first, xi_last, xi_cancellation, [&](const std::size_t xi_from, const std::size_t xi_to) {
+                    if constexpr (Execution::Traits<Policy>::vectorized) {
+                        serial<Assign>(xo_destination, xi_expression, xi_from, xi_to);
+                    }
+                    else {
+                        fused<Assign>(xo_destination, xi_expression, xi_from, xi_to);
+                    }
+                });
+            });
+            return completed;
+        }
+
+        /**
+        * \brief evaluate an expression into a destination (once pending asynchronous assignments to its operands completed)
+        *
+        * @param {Assign,     in}  assignment operation (AssignOperations)
+        * @param {T*,         out} destination
+        * @param {Expression, in}  expression
+        * @param {size_t,     in}  first position
+        * @param {size_t,     in}  last position (not included)
+        **/
+        template<typename Assign, typename T, typename Expression> void evaluate(T* xo_destination, const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_last) {
+            Async::readable(xi_expression);
+            run<Assign>(xo_destination, xi_expression, xi_first, xi_last);
+        }
+
+        // reduce an expression over [first, last) on the calling thread, in order
+        template<typename T, typename Expression, typename Operation> T accumulate(const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_last,
+                                                                                   T xi_value, Operation& xi_operation) {
+            for (std::size_t i{ xi_first }; i < xi_last; ++i) {
+                xi_value = xi_operation(std::move(xi_value), Operands::at(xi_expression, i));
+            }
+            return xi_value;
+        }
+
+        // reduce an expression over [first, last) on the calling thread - arithmetic types are reduced in independent interleaved lanes
+        // (which vectorize), so the operation is applied out of order and should be commutative as well
+        template<typename T, typename Expression, typename Operation> T accumulate_unsequenced(const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_last,
+                                                                                               T xi_value, Operation& xi_operation) {
+            constexpr std::size_t Lanes{ 8 };
+            if constexpr (std::is_arithmetic<T>::value) {
+                if (xi_last - xi_first >= 2 * Lanes) {
+                    T lanes[Lanes];
+                    for (std::size_t k{}; k < Lanes; ++k) {
+                        lanes[k] = Operands::at(xi_expression, xi_first + k);
+                    }
+
+                    std::size_t i{ xi_first + Lanes };
+                    for (; i + Lanes <= xi_last; i += Lanes) {
+                        for (std::size_t k{}; k < Lanes; ++k) {
+                            lanes[k] = xi_operation(lanes[k], Operands::at(xi_expression, i + k));
+                        }
+                    }
+
+                    for (std::size_t k{}; k < Lanes; ++k) {
+                        xi_value = xi_operation(std::move(xi_value), lanes[k]);
+                    }
+                    return accumulate(xi_expression, i, xi_last, std::move(xi_value), xi_operation);
+                }
+            }
+            return accumulate(xi_expression, xi_first, xi_last, std::move(xi_value), xi_operation);
+        }
+
+        // reduce an expression over [first, last) in parallel - the range is split into grain sized pieces which are distributed on the
+        // work stealing scheduler (executed by at most the given amount of threads at a time), each piece is reduced separately (by partial(value, first, last))
+        // and partial results are combined in piece order. given a cancellation, it is checked before every piece (nothing is returned if pieces were skipped)
+        template<typename T, typename Expression, typename Operation, typename Partial> std::optional<T> reduce_pieces(const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_last,
+                                                                                                                       T xi_initial, Operation& xi_operation, Partial&& xi_partial,
+                                                                                                                       const std::size_t xi_threads, const Cancellation* xi_cancellation = nullptr) {
+            const std::size_t piece{ grain<T, typename std::decay<Expression>::type>() },
+                              pieces{ (xi_last - xi_first + piece - 1) / piece };
+            Scratch::Scope scope;
+            Scratch::Array<T> partials(pieces);
+            const bool completed{ scheduler().run(0, pieces, 1, [&](const std::size_t xi_from, const std::size_t xi_to) {
+                for (std::size_t part{ xi_from }; part < xi_to; ++part) {
+                    const std::size_t first{ xi_first + part * piece };
+                    partials[part] = xi_partial(T(Operands::at(xi_expression, first)), first + 1, std::min(xi_last, first + piece));
+                }
+            }, xi_cancellation, xi_threads) };
+            if (!completed) return std::nullopt;
+
+            for (std::size_t part{}; part < pieces; ++part) {
+                xi_initial = xi_operation(std::move(xi_initial), partials[part]);
+            }
+            return xi_initial;
+        }
+
+        /**
+        * \brief reduce an expression over [first, last) - long expressions are reduced in parallel (same choice as evaluate)
+        *
+        * @param {Expression, in}  expression
+        * @param {size_t,     in}  first position
+        * @param {size_t,     in}  last position (not included)
+        * @param {T,          in}  initial value
+        * @param {Operation,  in}  associative binary operation
+        * @param {T,          out} operation(...operation(operation(initial, expression[first]), expression[first + 1])...)
+        **/
+        template<typename T, typename Expression, typename Operation> T reduce(const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_last,
+                                                                               T xi_initial, Operation xi_operation) {
+            Async::readable(xi_expression);
+            const auto partial = [&xi_expression, &xi_operation](T xi_value, const std::size_t xi_from, const std::size_t xi_to) {
+                return accumulate(xi_expression, xi_from, xi_to, std::move(xi_value), xi_operation);
+            };
+
+            const std::size_t length{ xi_last - xi_first };
+            if ((length == 0) || (choose<T, typename std::decay<Expression>::type>(length) != Strategy::Parallel)) {
+                return partial(std::move(xi_initial), xi_first, xi_last);
+            }
+            return *reduce_pieces(xi_expression, xi_first, xi_last, std::move(xi_initial), xi_operation, partial, concurrency());
+        }
+
+        /**
+        * \brief reduce an expression over [first, last) with a given execution policy (Lazy::Execution) - parallel policies reduce
+        *        grain sized pieces on the work stealing scheduler, unsequenced policies reduce arithmetic types in interleaved lanes
+        *        (so the operation should be commutative as well)
+        *
+        * @param {Policy,     in}  execution policy
+        * @param {Expression, in}  expression
+        * @param {size_t,     in}  first position
+        * @param {size_t,     in}  last position (not included)
+        * @param {T,          in}  initial value
+        * @param {Operation,  in}  associative binary operation
+        * @param {T,          out} reduction result
+        **/
+        template<typename Policy, typename T, typename Expression, typename Operation> T reduce(const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_last,
+                                                                                                T xi_initial, Operation xi_operation) {
+            Async::readable(xi_expression);
+            const auto partial = [&xi_expression, &xi_operation](T xi_value, const std::size_t xi_from, const std::size_t xi_to) {
+                if constexpr (Execution::Traits<Policy>::vectorized) {
+                    return accumulate_unsequenced(xi_expression, xi_from, xi_to, std::move(xi_value), xi_operation);
+                }
+                else {
+                    return accumulate(xi_expression, xi_from, xi_to, std::move(xi_value), xi_operation);
+                }
+            };
+
+            if constexpr (Execution::Traits<Policy>::parallel) {
+                if (xi_last > xi_first) {
+                    return *reduce_pieces(xi_expression, xi_first, xi_last, std::move(xi_initial), xi_operation, partial, policy_concurrency());
+                }
+            }
+            return partial(std::move(xi_initial), xi_first, xi_last);
+        }
+
+        /**
+        * \brief reduce an expression over [first, last) unless cancelled - in parallel if the evaluator would (or the policy is parallel),
+        *        otherwise in grain sized pieces on the calling thread. the cancellation is checked before every piece.
+        *
+        * @param {Policy,       in}  execution policy (Execution::Traits), or void for the evaluator choice
+        * @param {Expression,   in}  expression
+        * @param {size_t,       in}  first position
+        * @param {size_t,       in}  last position (not included)
+        * @param {T,            in}  initial value
+        * @param {Operation,    in}  associative binary operation
+        * @param {Cancellation, in}  cancellation
+        * @param {optional,     out} reduction result (nothing if cancelled)
+        **/
+        template<typename Policy, typename T, typename Expression, typename Operation> std::optional<T> reduce(const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_last,
+                                                                                                                T xi_initial, Operation xi_operation, const Cancellation& xi_cancellation) {
+            using E = typename std::decay<Expression>::type;
+            Async::readable(xi_expression);
+            const auto partial = [&xi_expression, &xi_operation](T xi_value, const std::size_t xi_from, const std::size_t xi_to) {
+                if constexpr (Execution::Traits<Policy>::vectorized) {
+                    return accumulate_unsequenced(xi_expression, xi_from, xi_to, std::move(xi_value), xi_operation);
+                }
+                else {
+                    return accumulate(xi_expression, xi_from, xi_to, std::move(xi_value), xi_operation);
+                }
+            };
+
+            const std::size_t length{ xi_last - xi_first };
+            const bool parallel{ std::is_void<Policy>::value ? (choose<T, E>(length) == Strategy::Parallel) : Execution::Traits<Policy>::parallel };
+            if (parallel && (length > 0)) {
+                return reduce_pieces(xi_expression, xi_first, xi_last, std::move(xi_initial), xi_operation, partial,
+                                     std::is_void<Policy>::value ? concurrency() : policy_concurrency(), &xi_cancellation);
+            }
+
+            const std::size_t piece{ grain<T, E>() };
+            for (std::size_t first{ xi_first }; first < xi_last; first += piece) {
+                if (xi_cancellation.cancelled()) return std::nullopt;
+                xi_initial = partial(std::move(xi_initial), first, std::min(xi_last, first + piece));
+            }
+            return xi_initial;
+        }
+
+        /**
+        * \brief scan an expression into a destination over [first, last) with a given execution policy (Lazy::Execution).
+        *        parallel policies scan in three passes - grain sized pieces are reduced in parallel, piece offsets are accumulated
+        *        in order, then pieces are scanned in parallel from their offsets (the operation should be associative).
+        *        scans are not vectorized, so unsequenced policies scan like their sequenced counterparts.
+        *
+        * @param {Policy,     in}  execution policy
+        * @param {bool,       in}  inclusive scan (destination[i] includes expression[i]), otherwise exclusive
+        * @param {T*,         out} destination (may be an operand of the expression)
+        * @param {Expression, in}  expression
+        * @param {size_t,     in}  first position
+        * @param {size_t,     in}  last position (not included)
+        * @param {T,          in}  initial value
+        * @param {bool,       in}  is there an initial value? (an inclusive scan without one starts with expression[first])
+        * @param {Operation,  in}  associative binary operation
+        **/
+        template<typename Policy, bool Inclusive, typename T, typename Expression, typename Operation> void scan(T* xo_destination, const Expression& xi_expression, const std::size_t xi_first, const std::size_t xi_last,
+                                                                                                                 T xi_initial, const bool xi_seeded, Operation xi_operation) {
+            Async::readable(xi_expression);
+
+            // scan [from, to) starting with a value (or with the first element, if not seeded)
+            const auto segment = [xo_destination, &xi_expression, &xi_operation](std::size_t xi_from, const std::size_t xi_to, T xi_value, const bool xi_valued) {
+                if (xi_from == xi_to) return;
+                if constexpr (Inclusive) {
+                    if (!xi_valued) {
+                        xi_value = Operands::at(xi_expression, xi_from);
+                        xo_destination[xi_from++] = xi_value;
+                    }
+                    for (std::size_t i{ xi_from }; i < xi_to; ++i) {
+                        xi_value = xi_operation(std::move(xi_value), Operands::at(xi_expression, i));
+                        xo_destination[i] = xi_value;
+                    }
+                }
+                else {
+                    for (std::size_t i{ xi_from }; i < xi_to; ++i) {
+                        T element(Operands::at(xi_expression, i));
+                        xo_destination[i] = xi_value;
+                        xi_value = xi_operation(std::move(xi_value), std::move(element));
+                    }
+                }
+            };
+
+            const std::size_t piece{ grain<T, typename std::decay<Expression>::type>() },
+                              pieces{ (xi_last - xi_first + piece - 1) / piece };
+            if (!Execution::Traits<Policy>::parallel || (pieces <= 1) || (scheduler().workers() == 0)) {
+                segment(xi_first, xi_last, std::move(xi_initial), xi_seeded);
+                return;
+            }
+
+            // reduce pieces (but the last one)
+            Scratch::Scope scope;
+            Scratch::Array<T> offsets(pieces);
+            scheduler().run(0, pieces - 1, 1, [&](const std::size_t xi_from, const std::size_t xi_to) {
+                for (std::size_t part{ xi_from }; part < xi_to; ++part) {
+                    const std::size_t first{ xi_first + part * piece };
+                    offsets[part] = accumulate(xi_expression, first + 1, first + piece, T(Operands::at(xi_expression, first)), xi_operation);
+                }
+            }, nullptr, policy_concurrency());
+
+            // piece offsets, in order (every piece but the first is seeded)
+            T value{ std::move(xi_initial) };
+            for (std::size_t part{}; part + 1 < pieces; ++part) {
+                T reduced{ std::move(offsets[part]) };
+                offsets[part] = value;
+                value = ((part > 0) || xi_seeded) ? xi_operation(std::move(value), std::move(reduced)) : std::move(reduced);
+            }
+            offsets[pieces - 1] = std::move(value);
+
+            // scan pieces from their offsets
+            scheduler().run(0, pieces, 1, [&](const std::size_t xi_from, const std::size_t xi_to) {
+                for (std::size_t part{ xi_from }; part < xi_to; ++part) {
+                    const std::size_t first{ xi_first + part * piece };
+                    segment(first, std::min(xi_last, first + piece), offsets[part], (part > 0) || xi_seeded);
+                }
+            }, nullptr, policy_concurrency());
+        }
+    };
+    
+    /**
+    * \brief lazy element-wise evaluated vector
+    * 
+    * @param {T, in} vector underlying type
+    **/
+    template<typename T> class Vector {
+        // vector maximal possible size (seems like a reasonable number...)
+        const std::size_t MaximumPossibleSize{ 1'000'000'000 };
+
+        // properties
+        private:
+            std::size_t m_reservedSize{ 4 };    // vector reserved size
+            std::size_t m_size{ 0 };            // vector size
+            T *m_data;                          // data holder
+            std::unique_ptr<ZoneMap<T>> m_zoneMap;  // optional per block minimum/maximum summary
+            std::vector<DirtyRanges*> m_trackers;   // trackers notified with every modified range
+            mutable std::shared_future<void> m_pending; // latest queued asynchronous assignment accessing the vector
+            mutable bool m_pendingWrite{ false };       // does a pending assignment write the vector?
+
+            friend struct Async::Access;
+
+        // internal methods
+        private:
+
+            // wait for a pending asynchronous assignment writing the vector (before reading it)
+            void readable() const noexcept {
+                if (m_pending.valid() && m_pendingWrite) {
+                    wait();
+                }
+            }
+
+            // wait for all pending asynchronous assignments accessing the vector (before modifying it)
+            void writable() const noexcept {
+                if (m_pending.valid()) {
+                    wait();
+                }
+            }
+
+            // is the vector free of unfinished asynchronous assignments (writing it, or accessing it at all)? element access does
+            // not wait for pending assignments (so that it remains cheap), debug builds assert this instead
+            bool settled(const bool xi_written) const noexcept {
+                return !m_pending.valid() || finished(xi_written);
+            }
+
+            LAZY_VECTOR_NOINLINE bool finished(const bool xi_written) const noexcept {
+                return (xi_written && !m_pendingWrite) || Async::Executor::running() || Evaluation::Scheduler::executing() ||
+                       (m_pending.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+            }
+
+            // mark the vector as accessed by a queued asynchronous assignment (assignments complete in submission order,
+            // so the latest one is kept, and a vector remains written until it completes)
+            void pend(const std::shared_future<void>& xi_future, const bool xi_write) const {
+                m_pendingWrite = xi_write || (m_pending.valid() && m_pendingWrite);
+                m_pending = xi_future;
+            }
+
+            // allocate a buffer of a given amount of (default constructed) elements (drawn from the buffer pool, unless over aligned)
+            static T* allocate(const std::size_t xi_count) {
+                Statistics::allocation(xi_count * sizeof(T));
+                if constexpr (alignof(T) > alignof(std::max_align_t)) {
+                    return new T[xi_count];
+                }
+                else {
+                    if (xi_count > std::numeric_limits<std::size_t>::max() / sizeof(T)) throw std::bad_alloc();
+
+                    T* data{ static_cast<T*>(Memory::Pool::acquire(xi_count * sizeof(T), xi_count)) };
+                    try {
+                        std::uninitialized_default_construct_n(data, xi_count);
+                    }
+                    catch (...) {
+                        Memory::Pool::release(data);
+                        throw;
+                    }
+                    return data;
+                }
+            }
+
+            // destroy and release a buffer
+            static void deallocate(T* xi_data) noexcept {
+                if constexpr (alignof(T) > alignof(std::max_align_t)) {
+                    delete[] xi_data;
+                }
+                else if (xi_data != nullptr) {
+                    std::destroy_n(xi_data, Memory::Pool::count(xi_data));
+                    Memory::Pool::release(xi_data);
+                }
+            }
+
+            // reallocate vector (used when increasing vector size beyond its current size)
+            inline void reallocate() {
+                Statistics::reallocation(m_size * sizeof(T));
+
+                T *temp = allocate(m_reservedSize);
+                if constexpr (std::is_trivially_copyable<T>::value) {
+                    memcpy(temp, m_data, m_size * sizeof(T));
+                }
+                else {
+                    // (elements whose move may throw are copied, so the current buffer is intact if the transfer throws)
+                    try {
+                        for (std::size_t i{}; i < m_size; ++i) {
+                            if constexpr (std::is_nothrow_move_assignable<T>::value || !std::is_copy_assignable<T>::value) {
+                                temp[i] = std::move(m_data[i]);
+                            }
+                            else {
+                                temp[i] = m_data[i];
+                            }
+                        }
+                    }
+                    catch (...) {
+                        deallocate(temp);
+                        throw;
+                    }
+                }
+                deallocate(m_data);
+                m_data = temp;
+            }
+
+            // move a range of elements to a (possibly overlapping) position within the buffer.
+            // buffer elements are always constructed, so non trivially copyable elements are move assigned rather than copied bitwise
+            inline void shift(T* xo_destination, T* xi_source, const std::size_t xi_count) {
+                if constexpr (std::is_trivially_copyable<T>::value) {
+                    memmove(xo_destination, xi_source, xi_count * sizeof(T));
+                }
+                else if (xo_destination < xi_source) {
+                    std::move(xi_source, xi_source + xi_count, xo_destination);
+                }
+                else {
+                    std::move_backward(xi_source, xi_source + xi_count, xo_destination + xi_count);
+                }
+            }
+
+            // release the state held by vacated elements (they are destroyed only when the buffer is deleted)
+            inline void release(const std::size_t xi_first, const std::size_t xi_last) {
+                if constexpr (!std::is_trivially_copyable<T>::value) {
+                    for (std::size_t i{ xi_first }; i < xi_last; ++i) {
+                        m_data[i] = T{};
+                    }
+                }
+            }
+
+            // shrink the buffer after elements were removed, if the release policy (Memory::settings) asks for it.
+            // shrinking is opportunistic - if the smaller buffer can not be allocated (or its elements constructed) the vector keeps its buffer
+            inline void shrunk() noexcept {
+                const Memory::Settings& policy{ Memory::settings() };
+                if ((policy.shrinkFraction <= 0.0) || (m_reservedSize * sizeof(T) < policy.shrinkBytes) ||
+                    (static_cast<double>(m_size) >= policy.shrinkFraction * static_cast<double>(m_reservedSize))) {
+                    return;
+                }
+
+                const std::size_t reserved{ m_reservedSize };
+                m_reservedSize = std::max<std::size_t>(2 * m_size, 4);
+                if (m_reservedSize >= reserved) {
+                    m_reservedSize = reserved;
+                    return;
+                }
+
+                try {
+                    reallocate();
+                }
+                catch (...) {
+                    m_reservedSize = reserved;
+                }
+            }
+
+            // invalidate content summaries and notify dirty range trackers (called by every operation which might modify vector content).
+            // a range whose end is not given extends to the end of the vector (used when elements are shifted or vector is reassigned)
+            inline void modified(const std::size_t xi_first = 0, const std::size_t xi_last = std::numeric_limits<std::size_t>::max()) noexcept {
+                writable();
+                changed(xi_first, xi_last);
+            }
+
+            // element modification - invalidate content summaries and notify dirty range trackers (without waiting for pending asynchronous assignments)
+            inline void accessed(const std::size_t xi_first, const std::size_t xi_last) noexcept {
+                assert(settled(false));
+                changed(xi_first, xi_last);
+            }
+
+            // invalidate content summaries and notify dirty range trackers (without waiting for pending asynchronous assignments)
+            inline void changed(const std::size_t xi_first, const std::size_t xi_last) noexcept {
+                if (m_zoneMap) {
+                    m_zoneMap->invalidate();
+                }
+                for (DirtyRanges* tracker : m_trackers) {
+                    tracker->mark(xi_first, xi_last);
+                }
+            }
+
+        // types
+        public:
+            using value_type = T;
+            using iterator = T*;
+            using const_iterator = const T*;
+            using reverse_iterator = std::reverse_iterator<iterator>;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+            using difference_type = ptrdiff_t;
+
+        // constructors
+        public:
+
+            // empty constructor
+            Vector() noexcept {
+                m_data = allocate(m_reservedSize);
+                Footprint::constructed(this);
+            }
+
+            // construct a vector by its size
+            explicit constexpr Vector(const std::size_t xi_size) {
+                // new size's
+                m_reservedSize = 2 * xi_size;
+                m_size = xi_size;
+
+                // allocate and fill data container
+                m_data = allocate(m_reservedSize);
+                for (std::size_t i{}; i < xi_size; ++i) {
+                    m_data[i] = T{};
+                }
+                Footprint::constructed(this);
+            }
+
+            // construct a vector by its size and initial value
+            explicit constexpr Vector(const std::size_t xi_size, const T& xi_value) {
+                // new size's
+                m_reservedSize = 2 * xi_size;
+                m_size = xi_size;
+
+                // allocate and fill data container
+                m_data = allocate(m_reservedSize);
+                for (std::size_t i{}; i < xi_size; ++i) {
+                    m_data[i] = xi_value;
+                }
+                Footprint::constructed(this);
+            }
+
+            // construct a vector by iterators
+            explicit constexpr Vector(T* xi_first, T* xi_last) {
+                const std::size_t len{ xi_last - xi_first };
+
+                // new size's
+                m_reservedSize = 2 * len;
+                m_size = len;
+
+                // allocate and fill data container
+                m_data = allocate(m_reservedSize);
+                for (std::size_t i{}; i < len; ++i, ++xi_first) {
+                    m_data[i] = *xi_first;
+                }
+                Footprint::constructed(this);
+            }
+
+            // construct a vector from initializer list
+            explicit constexpr Vector(std::initializer_list<T> xi_list) {
+                // new size's
+                m_reservedSize = 2 * xi_list.size();
+                m_size = xi_list.size();
+
+                // allocate and fill data container
+                m_data = allocate(m_reservedSize);
+                std::size_t i{};
+                for (auto &item : xi_list) {
+                    m_data[i++] = item;
+                }
+                Footprint::constructed(this);
+            }
+
+            // copy constructor
+            Vector(const Vector& xi_other) {
+                xi_other.readable();
+                // new size's
+                m_reservedSize = xi_other.m_reservedSize;
+                m_size = xi_other.m_size;
+
+                // allocate and fill data container
+                m_data = allocate(m_reservedSize);
+                for (std::size_t i{}; i < xi_other.m_size; ++i) {
+                    m_data[i] = xi_other.m_data[i];
+                }
+
+                // summaries are rebuilt on demand
+                if (xi_other.m_zoneMap) {
+                    m_zoneMap = std::make_unique<ZoneMap<T>>(xi_other.m_zoneMap->block_size());
+                }
+                Footprint::constructed(this);
+            }
+
+            // move constructor (takes over the buffer, leaving the moved from vector empty)
+            Vector(Vector&& xi_other) noexcept {
+                m_reservedSize = xi_other.m_reservedSize;
+                m_size = xi_other.m_size;
+                m_data = xi_other.m_data;
+                m_zoneMap = std::move(xi_other.m_zoneMap);
+                m_pending = std::move(xi_other.m_pending);
+                m_pendingWrite = xi_other.m_pendingWrite;
+
+                xi_other.m_data = nullptr;
+                xi_other.m_size = 0;
+                xi_other.m_reservedSize = 0;
+                xi_other.m_pending = {};
+                Footprint::constructed(this);
+            }
+
+            // destructor
+            ~Vector() {
+                writable();
+                Footprint::destroyed(this);
+                deallocate(m_data);
+            }
+
+            // copy assignment
+            Vector& operator = (const Vector& xi_other) {
+                modified();
+                xi_other.readable();
+
+                // allocate
+                if (m_reservedSize < xi_other.m_size) {
+                    m_reservedSize = 2 * xi_other.m_size;
+                    reallocate();
+                }
+                m_size = xi_other.m_size;
+
+                // fill data container
+                for (std::size_t i{}; i < xi_other.m_size; ++i) {
+                    m_data[i] = xi_other.m_data[i];
+                }
+
+                return *this;
+            }
+
+            // move assignment (takes over the buffer, leaving the moved from vector empty)
+            Vector& operator = (Vector&& xi_other) noexcept {
+                if (this == &xi_other) return *this;
+                modified();
+
+                deallocate(m_data);
+                m_reservedSize = xi_other.m_reservedSize;
+                m_size = xi_other.m_size;
+                m_data = xi_other.m_data;
+                m_zoneMap = std::move(xi_other.m_zoneMap);
+                m_pending = std::move(xi_other.m_pending);
+                m_pendingWrite = xi_other.m_pendingWrite;
+                xi_other.m_pending = {};
+
+                xi_other.modified();
+                xi_other.m_data = nullptr;
+                xi_other.m_size = 0;
+                xi_other.m_reservedSize = 0;
+
+                return *this;
+            }
+
+            // construct from a binary expression
+            template<typename LE, typename Op, typename RE> Vector(BinaryExpression<LE, Op, RE>&& xi_expression) {
+                for (std::size_t i{}; i < m_size; ++i) {
+                    this->operator[](i) = xi_expression[i];
+                }
+            }
+
+            // assign from a (right) expression
+            template<typename RightExpr, typename std::enable_if<!std::is_same<typename std::decay<RightExpr>::type, Vector>::value>::type* = nullptr>
+            Vector& operator =(RightExpr&& xi_expression) {
+                modified();
+
+                Evaluation::evaluate<AssignOperations::ASSIGN>(m_data, xi_expression, 0, m_size);
+                return *this;
+            }
+
+            // assign from initializer list
+            constexpr Vector& operator = (std::initializer_list<T> xi_list) {
+                modified();
+
+                // allocation               
+                if (m_reservedSize < xi_list.size()) {
+                    m_reservedSize = 2 * xi_list.size();
+                    reallocate();
+                }
+
+                // fill data container
+                m_size = 0;
+                for (auto& item : xi_list) {
+                    m_data[m_size++] = item;
+                }
+
+                return *this;
+            }
+            // assigns new contents to the vector, given size & value
+            void assign(const std::size_t xi_count, const T& xi_value) {
+                modified();
+
+                // allocate
+                if (xi_count > m_reservedSize) {
+                    m_reservedSize = 2 * xi_count;
+                    reallocate();
+                }
+                m_size = xi_count;
+
+                // fill
+                for (std::size_t i{}; i < xi_count; ++i) {
+                    m_data[i] = xi_value;
+                }
+            }
+
+            // assigns new contents to the vector, given start/end iterators
+            void assign(const T* xi_first, const T* xi_last) {
+                modified();
+
+                // allocate
+                const std::size_t count{ xi_last - xi_first };
+                if (count > m_reservedSize) {
+                    m_reservedSize = count << 2;
+                    reallocate();
+                }
+                m_size = count;
+
+                // fill
+                for (std::size_t i{}; i < count; ++i, ++xi_first) {
+                    m_data[i] = *xi_first;
+                }
+            }
+
+            // assigns new contents to the vector, given initializer list
+            void assign(std::initializer_list<T> xi_list) {
+                modified();
+
+                // allocate
+                const std::size_t count{ xi_list.size() };
+                if (count > m_reservedSize) {
+                    m_reservedSize = count << 2;
+                    reallocate();
+                }
+
+                m_size = count;
+
+                // fill
+                std::size_t i{};
+                for (auto& item : xi_list) {
+                    m_data[i++] = item;
+                }
+            }
+
+        // iterators
+        public:
+            
+                  T* begin()        noexcept { modified(); return m_data; }
+            const T* cbegin() const noexcept { readable(); return m_data; }
+
+                  T* end()        noexcept { modified(); return m_data + m_size; }
+            const T* cend() const noexcept { readable(); return m_data + m_size; }
+
+            reverse_iterator rbegin() noexcept { modified(); return reverse_iterator(m_data + m_size); }
+            const_reverse_iterator crbegin() const noexcept { readable(); return reverse_iterator(m_data + m_size); }
+
+            reverse_iterator rend() noexcept { modified(); return reverse_iterator(m_data); }
+            const_reverse_iterator crend() const noexcept { readable(); return reverse_iterator(m_data); }
+
+        // capacity queries/modifiers
+        public:
+
+            // is vector empty?
+            constexpr bool empty() const noexcept {
+                return (m_size == 0);
+            }
+
+            // return vector size
+            constexpr std::size_t size() const noexcept {
+                return m_size;
+            }
+
+            // return vector maximum possible size
+            constexpr std::size_t maxPossibleSize() const noexcept {
+                return MaximumPossibleSize;
+            }
+
+            // return vector capacity
+            constexpr std::size_t capacity() const noexcept {
+                return m_reservedSize;
+            }
+
+            // resize vector to a given size
+            void resize(const std::size_t xi_size) {
+                modified((xi_size < m_size) ? xi_size : m_size);
+
+                if (xi_size > m_size) {
+                    // allocate
+                    if (xi_size > m_reservedSize) {
+                        m_reservedSize = xi_size;
+                        reallocate();
+                    }
+                }
+                else {
+                    // release excess elements
+                    release(xi_size, m_size);
+                }
+
+                m_size = xi_size;
+                shrunk();
+            }
+
+            // resize vector to a given size and fill it with a given value
+            void resize(const std::size_t xi_size, const T& xi_value) {
+                modified((xi_size < m_size) ? xi_size : m_size);
+
+                if (xi_size > m_size) {
+                    // allocate
+                    if (xi_size > m_reservedSize) {
+                        m_reservedSize = xi_size;
+                        reallocate();
+                    }
+                    for (std::size_t i{ m_size }; i < xi_size; ++i)
+                        m_data[i] = xi_value;
+                }
+                else {
+                    // release excess elements
+                    release(xi_size, m_size);
+                }
+
+                m_size = xi_size;
+                shrunk();
+            }
+
+            // reserve a given size
+            void reserve(const std::size_t xi_size) {
+                writable();
+
+                // allocate
+                if (xi_size > m_reservedSize) {
+                    m_reservedSize = xi_size;
+                    reallocate();
+                }
+            }
+
+            // shrink vector to its current size
+            void shrink_to_fit() {
+                writable();
+                if (m_reservedSize == m_size) return;
+
+                m_reservedSize = m_size;
+                reallocate();
+            }
+
+            /**
+            * \brief return the memory pages of the unused capacity to the operating system (the capacity itself is kept, so this
+            *        never reallocates). only whole pages are released, so it is effective for large buffers (which are page backed);
+            *        vectors of non trivially copyable elements keep their pages.
+            *
+            * @param {size_t, out} amount of bytes released
+            **/
+            std::size_t release_unused() noexcept {
+                writable();
+                if constexpr (std::is_trivially_copyable<T>::value) {
+                    return Memory::advise(m_data + m_size, (m_reservedSize - m_size) * sizeof(T));
+                }
+                else {
+                    return 0;
+                }
+            }
+
+        // element wise access operations
+        public:
+
+            // [] operator overload
+            // (element access does not wait for pending asynchronous assignments - a vector accessed by one must be waited for first,
+            //  asserted in debug builds)
+                  T& operator [](std::size_t idx)       { accessed(idx, idx + 1); return m_data[idx]; }
+            LAZY_VECTOR_INLINE const T& operator [](std::size_t idx) const {
+                assert(settled(true));
+                return m_data[idx];
+            }
+
+            // unchecked element read, used by expressions and evaluators (which wait for pending asynchronous assignments once per evaluation)
+            LAZY_VECTOR_INLINE const T& element(const std::size_t xi_index) const noexcept { return m_data[xi_index]; }
+
+            // like [] but with exceptions
+            T& at(std::size_t pos) {
+                accessed(pos, pos + 1);
+
+                if (pos < m_size) {
+                    return m_data[pos];
+                } 
+                else {
+                    throw std::out_of_range("accessed position is out of range.");
+                }
+            }
+
+            const T& at(std::size_t pos) const {
+                assert(settled(true));
+
+                if (pos < m_size) {
+                    return m_data[pos];
+                } 
+                else {
+                    throw std::out_of_range("accessed position is out of range");
+                }
+            }
+
+            // return first element
+                  T& front()       { accessed(0, 1); return m_data[0]; }
+            const T& front() const { assert(settled(true)); return m_data[0]; }
+
+            // return last element
+                  T& back()       { accessed(m_size - 1, m_size); return m_data[m_size - 1]; }
+            const T& back() const { assert(settled(true)); return m_data[m_size - 1]; };
+
+        // underlying data access
+        public:
+                  T* data()       noexcept { modified(); return m_data; }
+            const T* data() const noexcept { readable(); return m_data; }
+
+        // asynchronous evaluation
+        public:
+
+            // wait for all pending asynchronous assignments accessing the vector
+            void wait() const noexcept {
+                if (m_pending.valid()) {
+                    m_pending.wait();
+                    m_pending = {};
+                    m_pendingWrite = false;
+                }
+            }
+
+            // does an asynchronous assignment still access the vector?
+            bool pending() const noexcept {
+                return m_pending.valid() && (m_pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready);
+            }
+
+        // content summaries
+        public:
+
+            // maintain a per block minimum/maximum summary of the vector (used to skip blocks when evaluating range predicates)
+            void enable_zone_map(const std::size_t xi_blockSize = 4096) {
+                m_zoneMap = std::make_unique<ZoneMap<T>>(xi_blockSize);
+            }
+
+            void disable_zone_map() noexcept {
+                m_zoneMap.reset();
+            }
+
+            // return an up to date per block summary (nullptr if summary is not maintained).
+            // notice that the summary is rebuilt lazily, so concurrent calls after a modification should be synchronized.
+            const ZoneMap<T>* zone_map() const {
+                if (m_zoneMap && m_zoneMap->dirty()) {
+                    m_zoneMap->rebuild(m_data, m_size);
+                }
+                return m_zoneMap.get();
+            }
+
+        // modification tracking
+        public:
+
+            // register a tracker to be notified with every modified range (tracker should outlive its registration)
+            void attach(DirtyRanges* xi_tracker) {
+                m_trackers.push_back(xi_tracker);
+            }
+
+            void detach(const DirtyRanges* xi_tracker) noexcept {
+                m_trackers.erase(std::remove(m_trackers.begin(), m_trackers.end(), xi_tracker), m_trackers.end());
+            }
+
+            // evaluate an expression over a range of positions [first, last) (positions outside the range are left untouched)
+            template<typename RightExpr> void assign_range(const RightExpr& xi_expression, const std::size_t xi_first, const std::size_t xi_last) {
+                assert(xi_last <= m_size);
+                modified(xi_first, xi_last);
+
+                Evaluation::evaluate<AssignOperations::ASSIGN>(m_data, xi_expression, xi_first, xi_last);
+            }
+
+        // general modifiers
+        public:
+            
+            // emplace elements to vector head
+            template <class... Args> void emplace_back(Args&& ... args) {
+                modified(m_size, m_size + 1);
+
+                if (m_size == m_reservedSize) {
+                    m_reservedSize = std::max<std::size_t>(2 * m_reservedSize, 4);
+                    reallocate();
+                }
+                m_data[m_size] = std::move(T(std::forward<Args>(args) ...));
+                ++m_size;
+            }
+
+            // push element to vector head
+            void push_back(const T& xi_value) {
+                modified(m_size, m_size + 1);
+
+                if (m_size == m_reservedSize) {
+                    m_reservedSize = std::max<std::size_t>(2 * m_reservedSize, 4);
+                    reallocate();
+                }
+                m_data[m_size] = xi_value;
+                ++m_size;
+            }
+
+            void push_back(T&& xi_value) {
+                modified(m_size, m_size + 1);
+
+                if (m_size == m_reservedSize) {
+                    m_reservedSize = std::max<std::size_t>(2 * m_reservedSize, 4);
+                    reallocate();
+                }
+                m_data[m_size] = std::move(xi_value);
+                ++m_size;
+            }
+
+            // remove element from vector head
+            void pop_back() {
+                modified(m_size - 1, m_size);
+
+                --m_size;
+                release(m_size, m_size + 1);
+                shrunk();
+            }
+
+            // push elements to a vector from a given iterator, return iterator to last element 
+            template <class ... Args> T* emplace(const T* xi_iterator, Args&& ... args) {
+                modified(static_cast<std::size_t>(xi_iterator - m_data));
+
+                const std::size_t index{ static_cast<std::size_t>(xi_iterator - m_data) };
+                if (m_size == m_reservedSize) {
+                    m_reservedSize = std::max<std::size_t>(2 * m_reservedSize, 4);
+                    reallocate();
+                }
+
+                iterator iit{ m_data + index };
+                shift(iit + 1, iit, m_size - index);
+                (*iit) = std::move(T(std::forward<Args>(args) ...));
+                ++m_size;
+
+                return iit;
+            }
+
+            // insert an element to a vector from a given iterator, return iterator to element
+            T* insert(const T* xi_iterator, const T& xi_value) {
+                modified(static_cast<std::size_t>(xi_iterator - m_data));
+
+                const std::size_t index{ static_cast<std::size_t>(xi_iterator - m_data) };
+                if (m_size == m_reservedSize) {
+                    m_reservedSize = std::max<std::size_t>(2 * m_reservedSize, 4);
+                    reallocate();
+                }
+
+                iterator iit{ m_data + index };
+                shift(iit + 1, iit, m_size - index);
+                (*iit) = xi_value;
+                ++m_size;
+
+                return iit;
+            }
+
+            
+            T* insert(const T* xi_iterator, T&& xi_value) {
+                modified(static_cast<std::size_t>(xi_iterator - m_data));
+
+                const std::size_t index{ static_cast<std::size_t>(xi_iterator - m_data) };
+                if (m_size == m_reservedSize) {
+                    m_reservedSize = std::max<std::size_t>(2 * m_reservedSize, 4);
+                    reallocate();
+                }
+
+                iterator iit{ m_data + index };
+                shift(iit + 1, iit, m_size - index);
+                (*iit) = std::move(xi_value);
+                ++m_size;
+
+                return iit;
+            }
+
+            // insert an element a given number of times to a vector from a given iterator, return iterator to element
+            T* insert(const T* xi_iterator, std::size_t xi_count, const T &xi_value) {
+                modified(static_cast<std::size_t>(xi_iterator - m_data));
+
+                const std::size_t index{ static_cast<std::size_t>(xi_iterator - m_data) };
+                if (!xi_count) return m_data + index;
+
+                if (m_size + xi_count > m_reservedSize) {
+                    m_reservedSize = (m_size + xi_count) << 2;
+                    reallocate();
+                }
+
+                iterator f{ m_data + index };
+                shift(f + xi_count, f, m_size - index);
+                m_size += xi_count;
+
+                for (iterator xi_iterator = f; xi_count--; ++xi_iterator) {
+                    (*xi_iterator) = xi_value;
+                }
+                return f;
+            }
+
+            // insert an elements given by iterator range to a vector at a given iterator, return iterator to last element inserted
+            template<class InputIt> T* insert(const T* xi_iterator, InputIt xi_first, InputIt xi_last) {
+                modified(static_cast<std::size_t>(xi_iterator - m_data));
+
+                const std::size_t index{ static_cast<std::size_t>(xi_iterator - m_data) },
+                                  cnt{ static_cast<std::size_t>(std::distance(xi_first, xi_last)) };
+                if (!cnt) return m_data + index;
+
+                if (m_size + cnt > m_reservedSize) {
+                    m_reservedSize = (m_size + cnt) << 2;
+                    reallocate();
+                }
+
+                iterator f{ m_data + index };
+                shift(f + cnt, f, m_size - index);
+                for (iterator xi_iterator = f; xi_first != xi_last; ++xi_iterator, ++xi_first) {
+                    (*xi_iterator) = *xi_first;
+                }
+                m_size += cnt;
+
+                return f;
+            }
+
+            // insert a list to a vector at a given iterator, return iterator to last element inserted
+            T* insert(const T* xi_iterator, std::initializer_list<T> xi_list) {
+                modified(static_cast<std::size_t>(xi_iterator - m_data));
+
+                const std::size_t cnt{ xi_list.size() },
+                                  index{ static_cast<std::size_t>(xi_iterator - m_data) };
+                if (!cnt) return m_data + index;
+
+                if (m_size + cnt > m_reservedSize) {
+                    m_reservedSize = (m_size + cnt) << 2;
+                    reallocate();
+                }
+
+                iterator f{ m_data + index };
+                shift(f + cnt, f, m_size - index);
+                iterator iit = f;
+                for (auto &item : xi_list) {
+                    (*iit) = item;
+                    ++iit;
+                }
+                m_size += cnt;
+
+                return f;
+            }
+
+            // erase element at a given iterator, return iterator to element found at new 'index'
+            T* erase(const T* xi_iterator) {
+                modified(static_cast<std::size_t>(xi_iterator - m_data));
+
+                const std::size_t index{ static_cast<std::size_t>(xi_iterator - m_data) };
+                iterator iit{ m_data + index };
+
+                shift(iit, iit + 1, m_size - index - 1);
+                --m_size;
+                release(m_size, m_size + 1);
+                shrunk();
+
+                return m_data + index;
+            }
+
+            // erase elements at a given range, return iterator to element found at new 'index'
+            T* erase(const T* xi_first, const T* xi_last) {
+                modified(static_cast<std::size_t>(xi_first - m_data));
+
+                const std::size_t index{ static_cast<std::size_t>(xi_first - m_data) };
+                iterator f{ m_data + index };
+                if (xi_first == xi_last) return f;
+
+                const std::size_t count{ static_cast<std::size_t>(xi_last - xi_first) };
+                shift(f, f + count, m_size - (xi_last - m_data));
+                m_size -= count;
+                release(m_size, m_size + count);
+                shrunk();
+
+                return m_data + index;
+            }
+
+            // swap two vectors
+            void swap(Vector<T> &rhs) {
+                const size_t tvec_sz{ m_size },
+                             trsrv_sz{ m_reservedSize };
+                T *tarr = m_data;
+
+                m_size = rhs.m_size;
+                m_reservedSize = rhs.m_reservedSize;
+                m_data = rhs.m_data;
+
+                rhs.m_size = tvec_sz;
+                rhs.m_reservedSize = trsrv_sz;
+                rhs.m_data = tarr;
+
+                m_zoneMap.swap(rhs.m_zoneMap);
+
+                modified();
+                rhs.modified();
+            }
+
+            // clear a vector (not noexcept - vacated elements are reset to T{}, and the buffer may shrink, which construct elements)
+            void clear() {
+                modified();
+
+                release(0, m_size);
+                m_size = 0;
+                shrunk();
+            }
+
+        // 'numerical'/logical/bitwise operator overload
+        public:
+
+            // '+'/'+=' overload 
+            template<typename RightExpr> Vector& operator +=(RightExpr&& xi_expression) {
+                modified();
+
+                Evaluation::evaluate<AssignOperations::ADD>(m_data, xi_expression, 0, m_size);
+                return *this;
+            }
+            template<typename RightExpr> auto operator +(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::ADD<T>, decltype(std::forward<RightExpr>(xi_expression))> {
+                return BinaryExpression<const Vector&, BinaryOperations::ADD<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            }
+
+            // '-'/'-=' overload 
+            template<typename RightExpr> Vector& operator -=(RightExpr&& xi_expression) {
+                modified();
+
+                Evaluation::evaluate<AssignOperations::SUB>(m_data, xi_expression, 0, m_size);
+                return *this;
+            }
+            template<typename RightExpr> auto operator -(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::SUB<T>, decltype(std::forward<RightExpr>(xi_expression))> {
+                return BinaryExpression<const Vector&, BinaryOperations::SUB<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            }
+
+            // '*'/'*=' overload 
+            template<typename RightExpr> Vector& operator *=(RightExpr&& xi_expression) {
+                modified();
+
+                Evaluation::evaluate<AssignOperations::MUL>(m_data, xi_expression, 0, m_size);
+                return *this;
+            }
+            template<typename RightExpr> auto operator *(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::MUL<T>, decltype(std::forward<RightExpr>(xi_expression))> {
+                return BinaryExpression<const Vector&, BinaryOperations::MUL<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            }
+
+            // '/'/'/=' overload 
+            template<typename RightExpr> Vector& operator /=(RightExpr&& xi_expression) {
+                modified();
+
+                Evaluation::evaluate<AssignOperations::DIV>(m_data, xi_expression, 0, m_size);
+                return *this;
+            }
+            template<typename RightExpr> auto operator /(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::DIV<T>, decltype(std::forward<RightExpr>(xi_expression))> {
+                return BinaryExpression<const Vector&, BinaryOperations::DIV<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            }
+
+            // '&'/'&=' overload 
+            template<typename RightExpr> Vector& operator &=(RightExpr&& xi_expression) {
+                modified();
+
+                Evaluation::evaluate<AssignOperations::LAND>(m_data, xi_expression, 0, m_size);
+                return *this;
+            }
+            template<typename RightExpr> auto operator &(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::LAND<T>, decltype(std::forward<RightExpr>(xi_expression))> {
+                return BinaryExpression<const Vector&, BinaryOperations::LAND<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            }
+
+            // '|'/'|=' overload 
+            template<typename RightExpr> Vector& operator |=(RightExpr&& xi_expression) {
+                modified();
+
+                Evaluation::evaluate<AssignOperations::LOR>(m_data, xi_expression, 0, m_size);
+                return *this;
+            }
+            template<typename RightExpr> auto operator |(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::LOR<T>, decltype(std::forward<RightExpr>(xi_expression))> {
+                return BinaryExpression<const Vector&, BinaryOperations::LOR<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            }
+
+            // '^'/'^=' overload 
+            template<typename RightExpr> Vector& operator ^=(RightExpr&& xi_expression) {
+                modified();
+
+                Evaluation::evaluate<AssignOperations::LXOR>(m_data, xi_expression, 0, m_size);
+                return *this;
+            }
+            template<typename RightExpr> auto operator ^(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::LXOR<T>, decltype(std::forward<RightExpr>(xi_expression))> {
+                return BinaryExpression<const Vector&, BinaryOperations::LXOR<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            }
+
+            // '<<'/'<<=' overload 
+            template<typename RightExpr> Vector& operator <<=(RightExpr&& xi_expression) {
+                modified();
+
+                Evaluation::evaluate<AssignOperations::SHL>(m_data, xi_expression, 0, m_size);
+                return *this;
+            }
+            template<typename RightExpr> auto operator <<(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::SHL<T>, decltype(std::forward<RightExpr>(xi_expression))> {
+                return BinaryExpression<const Vector&, BinaryOperations::SHL<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            }
+
+            // '>>'/'>>=' overload 
+            template<typename RightExpr> Vector& operator >>=(RightExpr&& xi_expression) {
+                modified();
+
+                Evaluation::evaluate<AssignOperations::SHR>(m_data, xi_expression, 0, m_size);
+                return *this;
+            }
+            template<typename RightExpr> auto operator >>(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::SHR<T>, decltype(std::forward<RightExpr>(xi_expression))> {
+                return BinaryExpression<const Vector&, BinaryOperations::SHR<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            }
+
+        // logical operator overload
+        public:
+
+            // '&&'
+            template<typename RightExpr> auto operator &&(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::AND<T>, decltype(std::forward<RightExpr>(xi_expression))> {
+                return BinaryExpression<const Vector&, BinaryOperations::AND<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            }
+
+            // '||'
+            template<typename RightExpr> auto operator ||(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::OR<T>, decltype(std::forward<RightExpr>(xi_expression))> {
+                return BinaryExpression<const Vector&, BinaryOperations::OR<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            }
+
+        // relational operator overload
+        public:
+
+            // '=='
+            template<typename RightExpr> auto operator ==(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::EQ<T>, decltype(std::forward<RightExpr>(xi_expression))> {
+                return BinaryExpression<const Vector&, BinaryOperations::EQ<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            }
+
+            // '!='
+            template<typename RightExpr> auto operator !=(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::NEQ<T>, decltype(std::forward<RightExpr>(xi_expression))> {
+                return BinaryExpression<const Vector&, BinaryOperations::NEQ<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            }
+
+            // '<'
+            template<typename RightExpr> auto operator <(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::LT<T>, decltype(std::forward<RightExpr>(xi_expression))> {
+                return BinaryExpression<const Vector&, BinaryOperations::LT<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            }
+
+            // '<='
+            template<typename RightExpr> auto operator <=(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::LE<T>, decltype(std::forward<RightExpr>(xi_expression))> {
+                return BinaryExpression<const Vector&, BinaryOperations::LE<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            }
+
+            // '>'
+            template<typename RightExpr> auto operator >(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::GT<T>, decltype(std::forward<RightExpr>(xi_expression))> {
+                return BinaryExpression<const Vector&, BinaryOperations::GT<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            }
+
+            // '>='
+            template<typename RightExpr> auto operator >=(RightExpr&& xi_expression) const -> BinaryExpression<const Vector&, BinaryOperations::GE<T>, decltype(std::forward<RightExpr>(xi_expression))> {
+                return BinaryExpression<const Vector&, BinaryOperations::GE<T>, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));
+            }
+    };
+
+    /**
+    * \brief a vector holding the (materialized) value of an expression, which is re-evaluated only over positions modified
+    *        (via operator[], insert, assign, ...) in the expression leaf vectors since last refresh. non const iteration (begin/end,
+    *        i.e. - a range based for over a non const leaf) and non const data() mark the whole leaf as modified, so the next refresh
+    *        re-evaluates all positions - read leafs through cbegin/cend (or a const reference) to keep refreshes incremental.
+    *        since expressions refer to temporaries, the expression is given by a generator which hands it over to a sink, i.e.:
+    *
+    *        Lazy::Vector<float> d;
+    *        auto view = Lazy::materialize(d, [&](auto&& sink) { sink((a + b) * c); }, a, b, c);
+    *        a[7] = 3.0f;
+    *        view.refresh();    // only d[7] is re-evaluated
+    *
+    *        leaf vectors should outlive the view, and expression must be element wise (position i depends only on leafs position i).
+    *
+    * @param {T,         in} destination underlying type
+    * @param {Generator, in} function(sink) which invokes sink with the expression
+    **/
+    template<typename T, typename Generator> class MaterializedView {
+        // properties
+        private:
+            Vector<T>& m_destination;                   // materialized expression
+            Generator m_generator;                      // expression generator
+            DirtyRanges m_dirty;                        // positions modified in leaf vectors
+            std::vector<std::function<void()>> m_detach;    // detach tracker from leaf vectors
+            bool m_valid{ false };                      // destination holds an evaluated expression
+
+        // constructors
+        public:
+
+            template<typename... Leaves> MaterializedView(Vector<T>& xi_destination, Generator xi_generator, Leaves&... xi_leaves) : m_destination(xi_destination), m_generator(std::move(xi_generator)) {
+                m_detach.reserve(sizeof...(Leaves));
+                (attach(xi_leaves), ...);
+                refresh();
+            }
+
+            // view is registered (by address) in its leaves, so it can not be copied nor moved
+            MaterializedView(const MaterializedView&) = delete;
+            MaterializedView& operator =(const MaterializedView&) = delete;
+
+            ~MaterializedView() {
+                for (auto& detach : m_detach) {
+                    detach();
+                }
+            }
+
+        // internal methods
+        private:
+
+            template<typename U> void attach(Vector<U>& xi_leaf) {
+                xi_leaf.attach(&m_dirty);
+                m_detach.emplace_back([&xi_leaf, this]() { xi_leaf.detach(&m_dirty); });
+            }
+
+        // evaluation
+        public:
+
+            // re-evaluate expression over modified positions (all positions on first evaluation, and new positions if leafs grew)
+            void refresh() {
+                m_generator([this](const auto& xi_expression) {
+                    const std::size_t len{ xi_expression.size() },
+                                      current{ m_valid ? m_destination.size() : 0 };
+
+                    if (m_destination.size() != len) {
+                        m_destination.resize(len);
+                    }
+
+                    for (const auto& range : m_dirty.take(std::min(current, len))) {
+                        m_destination.assign_range(xi_expression, range.first, range.second);
+                    }
+                    if (current < len) {
+                        m_destination.assign_range(xi_expression, current, len);
+                    }
+                });
+
+                m_valid = true;
+            }
+
+            // force full evaluation on next refresh
+            void invalidate() noexcept {
+                m_valid = false;
+                m_dirty.clear();
+            }
+
+        // queries
+        public:
+            const Vector<T>& value() const noexcept { return m_destination; }
+            const DirtyRanges& dirty() const noexcept { return m_dirty; }
+    };
+
+    /**
+    * \brief construct a materialized view of an expression
+    *
+    * @param {Vector,    in|out} destination vector (holds the materialized expression)
+    * @param {Generator, in}     function(sink) which invokes sink with the expression
+    * @param {Vector..., in}     expression leaf vectors
+    **/
+    template<typename T, typename Generator, typename... Leaves> MaterializedView<T, Generator> materialize(Vector<T>& xi_destination, Generator xi_generator, Leaves&... xi_leaves) {
+        return MaterializedView<T, Generator>(xi_destination, std::move(xi_generator), xi_leaves...);
+    }
+
+    /**
+    * \brief a deferred execution scope - assignments are recorded and executed on flush (or scope exit), where consecutive
+    *        element wise assignments of equal length are fused into a single loop over cache sized tiles.
+    *        i.e. - all recorded statements are executed over a tile before moving on to the next one,
+    *        so intermediate vectors written by one statement are still cached when read by the following statements:
+    *
+    *        {
+    *            Lazy::Deferred scope;
+    *            scope.assign(t, [&](auto&& sink) { sink(a + b); });
+    *            scope.assign(x, [&](auto&& sink) { sink(t * c); });
+    *            scope.assign(y, [&](auto&& sink) { sink(x - t); });
+    *        }   // one pass over a, b, c, t, x, y
+    *
+    *        a fusion group is closed when a statement length differs from the group length, when a statement operands are unknown
+    *        (anything besides vectors, scalars and expressions of them), or when a statement needs to resize a vector the group reads.
+    *        notice that a flush from destructor terminates on exception (call flush() explicitly to handle them).
+    **/
+    class Deferred {
+        // amount of cache (in bytes) which a tile of all vectors touched by a fusion group should occupy
+        static constexpr std::size_t TileBytes{ 128 * 1024 };
+
+        // a recorded assignment
+        struct Statement {
+            std::function<std::size_t()> length;                            // expression length
+            std::function<void(std::size_t, std::size_t)> evaluate;         // evaluate expression over [first, last)
+            std::function<std::size_t()> size;                              // destination length
+            std::function<void(std::size_t)> resize;                        // resize destination
+            const void* destination;                                        // destination vector address
+            std::size_t elementSize;                                        // destination element size
+            std::vector<const void*> reads;                                 // leaf vectors addresses
+            bool elementwise;                                               // all operands are known
+        };
+
+        // properties
+        private:
+            std::vector<Statement> m_statements;
+
+        // internal methods
+        private:
+
+            // execute a group of statements tile by tile
+            static void execute(const Statement* xi_first, const Statement* xi_last, const std::size_t xi_length, const std::size_t xi_bytes) {
+                const std::size_t tile{ std::max<std::size_t>(256, (TileBytes / std::max<std::size_t>(xi_bytes, 1)) & ~std::size_t{ 63 }) };
+
+                for (std::size_t first{}; first < xi_length; first += tile) {
+                    const std::size_t last{ std::min(first + tile, xi_length) };
+                    for (const Statement* statement{ xi_first }; statement != xi_last; ++statement) {
+                        statement->evaluate(first, last);
+                    }
+                }
+            }
+
+        // constructors
+        public:
+            Deferred() = default;
+            Deferred(const Deferred&) = delete;
+            Deferred& operator =(const Deferred&) = delete;
+
+            ~Deferred() {
+                flush();
+            }
+
+        // recording
+        public:
+
+            /**
+            * \brief record an assignment 'destination = expression'
+            *
+            * @param {Vector,    in|out} destination vector (should outlive the flush)
+            * @param {Generator, in}     function(sink) which invokes sink with the expression (as in Lazy::materialize)
+            **/
+            template<typename T, typename Generator> void assign(Vector<T>& xi_destination, Generator xi_generator) {
+                Statement statement;
+                statement.destination = &xi_destination;
+                statement.elementSize = sizeof(T);
+                xi_generator([&statement](const auto& xi_expression) {
+                    statement.elementwise = ExpressionTraits::collect_leaves(xi_expression, statement.reads);
+                });
+
+                statement.length = [xi_generator]() mutable {
+                    std::size_t len{};
+                    xi_generator([&len](const auto& xi_expression) { len = xi_expression.size(); });
+                    return len;
+                };
+                statement.evaluate = [&xi_destination, xi_generator](const std::size_t xi_first, const std::size_t xi_last) mutable {
+                    xi_generator([&xi_destination, xi_first, xi_last](const auto& xi_expression) {
+                        xi_destination.assign_range(xi_expression, xi_first, xi_last);
+                    });
+                };
+                statement.size = [&xi_destination]() {
+                    return xi_destination.size();
+                };
+                statement.resize = [&xi_destination](const std::size_t xi_size) {
+                    if (xi_destination.size() != xi_size) {
+                        xi_destination.resize(xi_size);
+                    }
+                };
+
+                m_statements.push_back(std::move(statement));
+            }
+
+            // amount of recorded (not yet executed) statements
+            std::size_t pending() const noexcept { return m_statements.size(); }
+
+        // execution
+        public:
+
+            // execute all recorded statements (in order, fused into as few loops as possible)
+            void flush() {
+                std::vector<Statement> statements;
+                statements.swap(m_statements);
+
+                std::vector<const void*> reads;     // vectors accessed by current group
+                std::size_t first{},                // current group first statement
+                            length{},               // current group length
+                            bytes{};                // current group bytes per position
+                bool elementwise{};                 // can current group be extended
+                for (std::size_t i{}; i < statements.size(); ++i) {
+                    Statement& statement{ statements[i] };
+                    const std::size_t len{ statement.length() };
+
+                    // close current group if statement can not join it
+                    if (i > first) {
+                        const bool resized{ statement.size() != len },
+                                   read{ std::find(reads.begin(), reads.end(), statement.destination) != reads.end() };
+                        if (!elementwise || !statement.elementwise || (len != length) || (resized && read)) {
+                            execute(statements.data() + first, statements.data() + i, length, bytes);
+                            first = i;
+                        }
+                    }
+
+                    // open a new group
+                    if (first == i) {
+                        reads.clear();
+                        length = len;
+                        bytes = 0;
+                        elementwise = statement.elementwise;
+                    }
+
+                    statement.resize(len);
+                    reads.insert(reads.end(), statement.reads.begin(), statement.reads.end());
+                    reads.push_back(statement.destination);
+                    bytes += statement.elementSize * (statement.reads.size() + 1);
+                }
+
+                if (first < statements.size()) {
+                    execute(statements.data() + first, statements.data() + statements.size(), length, bytes);
+                }
+            }
+    };
+
+    /**
+    * \brief a group of assignments evaluated concurrently on the work stealing scheduler (Evaluation::scheduler).
+    *        every assignment is split into chunks which are stolen by idle threads, and assignments start as soon as the assignments
+    *        they depend upon completed. dependencies are inferred from the vectors an assignment writes and reads:
+    *        an assignment waits for earlier assignments which write a vector it reads or writes, and for earlier assignments which read its destination.
+    *
+    *        {
+    *            Lazy::TaskGroup group;
+    *            group.assign(x, [&](auto&& sink) { sink(a + b); });
+    *            group.assign(y, [&](auto&& sink) { sink(a * c); });    // concurrently with x
+    *            group.assign(z, [&](auto&& sink) { sink(x - y); });    // once x and y were evaluated
+    *            group.wait();
+    *        }
+    *
+    *        assignments are evaluated over the destination size at submission, and vectors accessed by the group should not be
+    *        accessed (or resized) by other means until wait() returned. notice that a wait from destructor discards exceptions.
+    *        a group constructed with a cancellation stops evaluating chunks once it is cancelled (or its deadline passed) - every chunk
+    *        is then left either fully evaluated or untouched, and cancelled() tells if any chunk was skipped.
+    **/
+    class TaskGroup {
+        // a submitted assignment
+        struct Job {
+            std::function<void(std::size_t, std::size_t)> evaluate;       // evaluate expression over [first, last)
+            std::size_t length;                                             // destination length
+            std::size_t chunk;                                              // chunk length
+            std::size_t chunks;                                             // amount of chunks
+            const void* destination;                                        // destination vector address
+            std::vector<const void*> reads;                                 // leaf vectors addresses
+            std::atomic<std::size_t> remaining;                             // chunks not yet evaluated
+            std::size_t blockers{};                                         // unfinished assignments this one depends upon
+            std::vector<Job*> dependents;                                   // assignments depending upon this one
+            bool finished{ false };
+        };
+
+        // properties
+        private:
+            std::mutex m_mutex;                                             // guards dependency state and first error
+            std::deque<Job> m_jobs;                                         // (a deque, so jobs are never relocated)
+            std::atomic<std::size_t> m_unfinished{};                        // submitted assignments not yet evaluated
+            std::exception_ptr m_error;                                     // first exception thrown by an assignment
+            Cancellation m_cancellation;                                    // checked before every chunk
+            std::atomic<bool> m_skipped{ false };                           // was a chunk skipped due to cancellation?
+
+        // internal methods
+        private:
+
+            // does an assignment have to wait for an earlier one?
+            static bool depends(const Job& xi_job, const Job& xi_earlier) {
+                const auto contains = [](const std::vector<const void*>& xi_vectors, const void* xi_vector) {
+                    return std::find(xi_vectors.begin(), xi_vectors.end(), xi_vector) != xi_vectors.end();
+                };
+                return (xi_job.destination == xi_earlier.destination) ||   // write after write
+                       contains(xi_job.reads, xi_earlier.destination) ||   // read after write
+                       contains(xi_earlier.reads, xi_job.destination);     // write after read
+            }
+
+            // queue the chunks of an assignment whose dependencies completed
+            void start(Job& xio_job) {
+                Evaluation::Scheduler& scheduler{ Evaluation::scheduler() };
+                for (std::size_t i{}; i < xio_job.chunks; ++i) {
+                    scheduler.spawn([this, &xio_job, i]() { execute(xio_job, i); });
+                }
+            }
+
+            // evaluate an assignment chunk, the last chunk completes the assignment and starts assignments which depended only upon it
+            void execute(Job& xio_job, const std::size_t xi_chunk) {
+                const std::size_t first{ xi_chunk * xio_job.chunk },
+                                  last{ std::min(first + xio_job.chunk, xio_job.length) };
+                if (m_cancellation.cancelled()) {
+                    m_skipped.store(true, std::memory_order_relaxed);
+                }
+                else {
+                    try {
+                        xio_job.evaluate(first, last);
+                    }
+                    catch (...) {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        if (!m_error) m_error = std::current_exception();
+                    }
+                }
+                if (xio_job.remaining.fetch_sub(1) != 1) return;
+
+                std::vector<Job*> ready;
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    xio_job.finished = true;
+                    for (Job* dependent : xio_job.dependents) {
+                        if (--dependent->blockers == 0) {
+                            ready.push_back(dependent);
+                        }
+                    }
+                }
+                for (Job* job : ready) {
+                    start(*job);
+                }
+
+                // last access of the group (a waiting thread may destroy it once no assignment is left)
+                m_unfinished.fetch_sub(1);
+            }
+
+            // wait for all submitted assignments (executing queued tasks meanwhile)
+            void join() {
+                Evaluation::scheduler().help_until([this]() { return m_unfinished.load() == 0; });
+                m_jobs.clear();
+            }
+
+        // constructors
+        public:
+            TaskGroup() = default;
+            explicit TaskGroup(Cancellation xi_cancellation) : m_cancellation(std::move(xi_cancellation)) {}
+            TaskGroup(const TaskGroup&) = delete;
+            TaskGroup& operator =(const TaskGroup&) = delete;
+
+            ~TaskGroup() {
+                join();
+            }
+
+        // submission
+        public:
+
+            /**
+            * \brief submit an assignment 'destination = expression', evaluated over the current destination size
+            *
+            * @param {Vector,    in|out} destination vector (should outlive the group wait)
+            * @param {Generator, in}     function(sink) which invokes sink with the expression (as in Lazy::materialize)
+            **/
+            template<typename T, typename Generator> void assign(Vector<T>& xi_destination, Generator xi_generator) {
+                Job& job{ m_jobs.emplace_back() };
+                try {
+                    job.length = xi_destination.size();
+                    job.destination = &xi_destination;
+                    xi_generator([&job](const auto& xi_expression) {
+                        using Expression = typename std::decay<decltype(xi_expression)>::type;
+
+                        // pending asynchronous assignments are waited for here, not by workers
+                        Async::readable(xi_expression);
+                        ExpressionTraits::collect_leaves(xi_expression, job.reads);
+                        job.chunk = Evaluation::grain<T, Expression>();
+                        job.chunks = std::max<std::size_t>(1, (job.length + job.chunk - 1) / job.chunk);
+                    });
+                    job.remaining.store(job.chunks);
+
+                    T* destination{ xi_destination.data() };
+                    job.evaluate = [destination, xi_generator](const std::size_t xi_first, const std::size_t xi_last) mutable {
+                        xi_generator([destination, xi_first, xi_last](const auto& xi_expression) {
+                            Evaluation::serial<AssignOperations::ASSIGN>(destination, xi_expression, xi_first, xi_last);
+                        });
+                    };
+                }
+                catch (...) {
+                    m_jobs.pop_back();
+                    throw;
+                }
+
+                m_unfinished.fetch_add(1);
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    for (auto it{ m_jobs.begin() }, last{ std::prev(m_jobs.end()) }; it != last; ++it) {
+                        if (!it->finished && depends(job, *it)) {
+                            ++job.blockers;
+                            it->dependents.push_back(&job);
+                        }
+                    }
+                    if (job.blockers > 0) return;
+                }
+                start(job);
+            }
+
+        // completion
+        public:
+
+            // wait for all submitted assignments, rethrowing the first exception any of them threw
+            void wait() {
+                join();
+
+                std::exception_ptr error;
+                std::swap(error, m_error);
+                if (error) std::rethrow_exception(error);
+            }
+
+            // amount of submitted assignments not yet evaluated
+            std::size_t pending() const noexcept { return m_unfinished.load(); }
+
+            // were chunks skipped since the group was cancelled? (complete once wait() returned)
+            bool cancelled() const noexcept { return m_skipped.load(std::memory_order_relaxed); }
+    };
+
+    /**
+    * \brief a contiguous range of elements (a region of a ring buffer)
+    **/
+    template<typename T> struct Span {
+        T* data{ nullptr };
+        std::size_t size{};
+
+        T* begin() const noexcept { return data; }
+        T* end() const noexcept { return data + size; }
+        T& operator [](const std::size_t i) const noexcept { return data[i]; }
+    };
+
+    /**
+    * \brief a lock free bounded ring buffer over Vector storage, handing elements between threads without locks or copies.
+    *        the capacity is a power of two, and producer and consumer positions are kept in separate cache lines.
+    *        besides single element and bulk (copying) push/pop, producers write in place - write(count) claims free positions and returns
+    *        them as (up to) two spans (the second one holds the part which wraps around to the buffer start), and commit publishes them.
+    *        consumers likewise read(count) published positions in place, and release them:
+    *
+    *        Lazy::Ring<float> ring(1 << 16);
+    *        auto region = ring.write(4096);        // producer
+    *        std::fill(region.first.begin(), region.first.end(), 1.0f);
+    *        std::fill(region.second.begin(), region.second.end(), 1.0f);
+    *        ring.commit(region);
+    *        auto batch = ring.read(4096);          // consumer
+    *        ... (batch.first, batch.second)
+    *        ring.release(batch);
+    *
+    *        a single producer (consumer) claims positions with plain stores. with multiple producers (consumers) positions are claimed
+    *        with compare exchange, and commits (releases) are published in claim order, i.e. - a commit waits for the commits of earlier claims.
+    *
+    * @param {T,    in} element type (default constructible, elements are assigned by producers)
+    * @param {bool, in} multiple producers
+    * @param {bool, in} multiple consumers
+    **/
+    template<typename T, bool MultipleProducers = false, bool MultipleConsumers = false> class Ring {
+        public:
+
+            // a claimed region - positions [position, position + size), split into the part before the buffer end and the part wrapping around
+            struct Region {
+                Span<T> first;
+                Span<T> second;
+                std::size_t position{};
+
+                std::size_t size() const noexcept { return first.size + second.size; }
+                bool empty() const noexcept { return size() == 0; }
+                T& operator [](const std::size_t i) const noexcept { return (i < first.size) ? first.data[i] : second.data[i - first.size]; }
+            };
+
+        // properties
+        private:
+            Vector<T> m_buffer;
+            T* m_data;                                              // (buffer data, fixed once constructed)
+            std::size_t m_mask;
+            alignas(64) std::atomic<std::size_t> m_head{};          // next position to claim by producers
+            alignas(64) std::atomic<std::size_t> m_published{};     // positions below are readable
+            std::size_t m_producerLimit{};                          // cached released + capacity (single producer)
+            alignas(64) std::atomic<std::size_t> m_tail{};          // next position to claim by consumers
+            alignas(64) std::atomic<std::size_t> m_released{};      // positions below are writable again (plus capacity)
+            std::size_t m_consumerLimit{};                          // cached published (single consumer)
+
+        // internal methods
+        private:
+
+            Region region(const std::size_t xi_position, const std::size_t xi_count) noexcept {
+                const std::size_t index{ xi_position & m_mask },
+                                  first{ std::min(xi_count, m_mask + 1 - index) };
+                return Region{ { m_data + index, first }, { m_data, xi_count - first }, xi_position };
+            }
+
+            // wait for earlier claims to be published (released), then publish this one
+            static void advance(std::atomic<std::size_t>& xio_counter, const std::size_t xi_position, const std::size_t xi_count) {
+                for (std::size_t spins{}; xio_counter.load(std::memory_order_acquire) != xi_position; ++spins) {
+                    if (spins > 64) std::this_thread::yield();
+                }
+                xio_counter.store(xi_position + xi_count, std::memory_order_release);
+            }
+
+        // constructors
+        public:
+
+            // a ring holding at least a given amount of elements (rounded up to a power of two)
+            explicit Ring(const std::size_t xi_capacity) {
+                std::size_t capacity{ 2 };
+                while (capacity < xi_capacity) capacity *= 2;
+                m_buffer.resize(capacity);
+                m_data = m_buffer.data();
+                m_mask = capacity - 1;
+                m_producerLimit = capacity;
+            }
+
+            Ring(const Ring&) = delete;
+            Ring& operator =(const Ring&) = delete;
+
+        // producer side
+        public:
+
+            /**
+            * \brief claim free positions for in place writing (published by commit, which should follow every claim - even an empty one)
+            *
+            * @param {size_t, in}  maximal amount of positions
+            * @param {Region, out} claimed positions (fewer than requested, or none, if the ring is full)
+            **/
+            Region write(const std::size_t xi_count) noexcept {
+                const std::size_t capacity{ m_mask + 1 };
+                if constexpr (MultipleProducers) {
+                    // (the head may be observed ahead of the released count it was claimed against, so a limit which does not
+                    //  exceed the position is taken as a full ring rather than subtracted)
+                    std::size_t position{ m_head.load(std::memory_order_relaxed) };
+                    for (;;) {
+                        const std::size_t limit{ m_released.load(std::memory_order_acquire) + capacity };
+                        if (static_cast<std::ptrdiff_t>(limit - position) <= 0) return region(position, 0);
+
+                        const std::size_t count{ std::min(xi_count, limit - position) };
+                        if (m_head.compare_exchange_weak(position, position + count, std::memory_order_relaxed)) {
+                            return region(position, count);
+                        }
+                    }
+                }
+                else {
+                    const std::size_t position{ m_head.load(std::memory_order_relaxed) };
+                    if (m_producerLimit - position < xi_count) {
+                        m_producerLimit = m_released.load(std::memory_order_acquire) + capacity;
+                    }
+                    const std::size_t count{ std::min(xi_count, m_producerLimit - position) };
+                    m_head.store(position + count, std::memory_order_relaxed);
+                    return region(position, count);
+                }
+            }
+
+            // publish a region claimed by write (a single producer should commit its claims in claim order)
+            void commit(const Region& xi_region) noexcept {
+                if (xi_region.empty()) return;
+                if constexpr (MultipleProducers) {
+                    advance(m_published, xi_region.position, xi_region.size());
+                }
+                else {
+                    m_published.store(xi_region.position + xi_region.size(), std::memory_order_release);
+                }
+            }
+
+            // push an element unless the ring is full
+            bool try_push(const T& xi_value) {
+                const Region claimed{ write(1) };
+                if (!claimed.empty()) claimed.first[0] = xi_value;
+                commit(claimed);
+                return !claimed.empty();
+            }
+
+            /**
+            * \brief push (copy) a range of elements, as many as fit
+            *
+            * @param {T*,     in}  elements
+            * @param {size_t, in}  amount of elements
+            * @param {size_t, out} amount of elements pushed
+            **/
+            std::size_t push(const T* xi_values, const std::size_t xi_count) {
+                const Region claimed{ write(xi_count) };
+                std::copy_n(xi_values, claimed.first.size, claimed.first.data);
+                std::copy_n(xi_values + claimed.first.size, claimed.second.size, claimed.second.data);
+                commit(claimed);
+                return claimed.size();
+            }
+
+        // consumer side
+        public:
+
+            /**
+            * \brief claim published positions for in place reading (returned to producers by release, which should follow every claim)
+            *
+            * @param {size_t, in}  maximal amount of positions
+            * @param {Region, out} claimed positions (fewer than requested, or none, if the ring is empty)
+            **/
+            Region read(const std::size_t xi_count) noexcept {
+                if constexpr (MultipleConsumers) {
+                    // (the tail may be observed ahead of the published count, which is then taken as an empty ring)
+                    std::size_t position{ m_tail.load(std::memory_order_relaxed) };
+                    for (;;) {
+                        const std::size_t limit{ m_published.load(std::memory_order_acquire) };
+                        if (static_cast<std::ptrdiff_t>(limit - position) <= 0) return region(position, 0);
+
+                        const std::size_t count{ std::min(xi_count, limit - position) };
+                        if (m_tail.compare_exchange_weak(position, position + count, std::memory_order_relaxed)) {
+                            return region(position, count);
+                        }
+                    }
+                }
+                else {
+                    const std::size_t position{ m_tail.load(std::memory_order_relaxed) };
+                    if (m_consumerLimit - position < xi_count) {
+                        m_consumerLimit = m_published.load(std::memory_order_acquire);
+                    }
+                    const std::size_t count{ std::min(xi_count, m_consumerLimit - position) };
+                    m_tail.store(position + count, std::memory_order_relaxed);
+                    return region(position, count);
+                }
+            }
+
+            // return a region claimed by read to producers (a single consumer should release its claims in claim order)
+            void release(const Region& xi_region) noexcept {
+                if (xi_region.empty()) return;
+                if constexpr (MultipleConsumers) {
+                    advance(m_released, xi_region.position, xi_region.size());
+                }
+                else {
+                    m_released.store(xi_region.position + xi_region.size(), std::memory_order_release);
+                }
+            }
+
+            // pop an element unless the ring is empty
+            bool try_pop(T& xo_value) {
+                const Region claimed{ read(1) };
+                if (!claimed.empty()) xo_value = std::move(claimed.first[0]);
+                release(claimed);
+                return !claimed.empty();
+            }
+
+            /**
+            * \brief pop (move) a range of elements, as many as available
+            *
+            * @param {T*,     out} elements
+            * @param {size_t, in}  maximal amount of elements
+            * @param {size_t, out} amount of elements popped
+            **/
+            std::size_t pop(T* xo_values, const std::size_t xi_count) {
+                const Region claimed{ read(xi_count) };
+                std::move(claimed.first.begin(), claimed.first.end(), xo_values);
+                std::move(claimed.second.begin(), claimed.second.end(), xo_values + claimed.first.size);
+                release(claimed);
+                return claimed.size();
+            }
+
+        // queries
+        public:
+            std::size_t capacity() const noexcept { return m_mask + 1; }
+
+            // amount of published elements not yet claimed by consumers (approximate while other threads operate)
+            std::size_t size() const noexcept {
+                const std::size_t tail{ m_tail.load(std::memory_order_acquire) };
+                const std::size_t published{ m_published.load(std::memory_order_acquire) };
+                return (published > tail) ? (published - tail) : 0;
+            }
+            bool empty() const noexcept { return size() == 0; }
+    };
+
+    /**
+    * \brief a streaming pipeline - producers push fixed size chunks, a stage (an expression or a reduction over a chunk) is applied to
+    *        every chunk on the work stealing scheduler (Evaluation::scheduler), and consumers pop the results in push order:
+    *
+    *        Lazy::Pipeline<float, double> energy(4096, 8, [](const Lazy::Vector<float>& chunk, double& out) { out = Lazy::sum(chunk * chunk); });
+    *        Lazy::Vector<float> samples(4096);
+    *        ... (fill samples)
+    *        energy.push(samples);      // samples now holds a recycled chunk buffer
+    *        double e;
+    *        while (energy.pop(e)) { ... }
+    *
+    *        chunks are held in a bounded lock free ring - every slot carries a sequence number telling whether it is free for the
+    *        position a producer claims, holds a chunk being processed, or holds a result ready for the consumer popping its position.
+    *        a producer is blocked (backpressure) while the ring is full, i.e. - capacity chunks were pushed and their results not popped yet.
+    *        buffers are exchanged rather than copied, so a steady stream allocates nothing: push swaps the chunk with the buffer of an
+    *        already consumed chunk (allocated with chunk size on construction), and pop swaps the result with the consumer buffer.
+    *        a consumer waiting for a result executes queued stage tasks meanwhile.
+    *
+    * @param {In,  in} chunk element type
+    * @param {Out, in} stage result type (i.e. - Vector<Out> for an expression, a scalar for a reduction)
+    **/
+    template<typename In, typename Out> class Pipeline {
+        public:
+            using Stage = std::function<void(const Vector<In>&, Out&)>;
+
+        // a ring slot - sequence is 4 * position + state (state: 0 - free, 1 - chunk pushed, 2 - result ready)
+        struct alignas(64) Slot {
+            std::atomic<std::size_t> sequence{};
+            Vector<In> input;
+            Out output{};
+            std::exception_ptr error;
+        };
+
+        enum : std::size_t { Free = 0, Pushed = 1, Ready = 2 };
+
+        // properties
+        private:
+            Stage m_stage;
+            std::size_t m_chunk;
+            std::vector<std::unique_ptr<Slot>> m_slots;
+            alignas(64) std::atomic<std::size_t> m_head{};      // next position to push
+            alignas(64) std::atomic<std::size_t> m_tail{};      // next position to pop
+            alignas(64) std::atomic<std::size_t> m_running{};   // stage tasks not yet completed
+            std::atomic<bool> m_closed{ false };
+            std::mutex m_mutex;                                 // guards blocked producers
+            std::condition_variable m_space;                    // signals a consumed slot (or closing)
+            std::atomic<std::size_t> m_blocked{};               // producers waiting on m_space
+
+        // internal methods
+        private:
+
+            Slot& slot(const std::size_t xi_position) const noexcept {
+                return *m_slots[xi_position % m_slots.size()];
+            }
+
+            // apply the stage to a pushed chunk
+            void process(Slot& xio_slot, const std::size_t xi_position) {
+                try {
+                    m_stage(xio_slot.input, xio_slot.output);
+                }
+                catch (...) {
+                    xio_slot.error = std::current_exception();
+                }
+                xio_slot.sequence.store(4 * xi_position + Ready);
+
+                // last access of the pipeline (it may be destroyed once no stage is running)
+                m_running.fetch_sub(1);
+            }
+
+            // can a position be popped (or is the pipeline closed and drained)?
+            bool poppable() const noexcept {
+                const std::size_t position{ m_tail.load() };
+                return (slot(position).sequence.load() == 4 * position + Ready) ||
+                       (m_closed.load() && (position == m_head.load()));
+            }
+
+        // constructors
+        public:
+
+            /**
+            * @param {size_t, in} chunk size (slot input buffers are allocated with this size)
+            * @param {size_t, in} capacity - maximal amount of chunks pushed and not yet popped
+            * @param {Stage,  in} stage - function(chunk, result) applied to every chunk
+            **/
+            Pipeline(const std::size_t xi_chunk, const std::size_t xi_capacity, Stage xi_stage) : m_stage(std::move(xi_stage)), m_chunk(xi_chunk) {
+                const std::size_t capacity{ std::max<std::size_t>(1, xi_capacity) };
+                m_slots.reserve(capacity);
+                for (std::size_t i{}; i < capacity; ++i) {
+                    m_slots.push_back(std::make_unique<Slot>());
+                    m_slots.back()->sequence.store(4 * i);
+                    m_slots.back()->input.resize(xi_chunk);
+                }
+            }
+
+            Pipeline(const Pipeline&) = delete;
+            Pipeline& operator =(const Pipeline&) = delete;
+
+            // closes the pipeline and waits for running stages (results not popped are discarded)
+            ~Pipeline() {
+                close();
+                Evaluation::scheduler().help_until([this]() { return m_running.load() == 0; });
+            }
+
+        // producer side
+        public:
+
+            /**
+            * \brief push a chunk unless the ring is full (the chunk is exchanged with a recycled buffer)
+            *
+            * @param {Vector, in|out} chunk
+            * @param {bool,   out}    was the chunk pushed? (false if the ring is full or the pipeline is closed)
+            **/
+            bool try_push(Vector<In>& xio_chunk) {
+                if (m_closed.load()) return false;
+
+                std::size_t position{ m_head.load() };
+                for (;;) {
+                    Slot& current{ slot(position) };
+                    const std::size_t sequence{ current.sequence.load() };
+                    if (sequence < 4 * position + Free) return false;
+
+                    if (sequence == 4 * position + Free) {
+                        if (m_head.compare_exchange_weak(position, position + 1)) break;
+                    }
+                    else {
+                        position = m_head.load();
+                    }
+                }
+
+                Slot& claimed{ slot(position) };
+                claimed.input.swap(xio_chunk);
+                m_running.fetch_add(1);
+                claimed.sequence.store(4 * position + Pushed);
+                Evaluation::scheduler().spawn([this, &claimed, position]() { process(claimed, position); });
+                return true;
+            }
+
+            /**
+            * \brief push a chunk, waiting while the ring is full (the chunk is exchanged with a recycled buffer)
+            *
+            * @param {Vector, in|out} chunk
+            * @param {bool,   out}    was the chunk pushed? (false if the pipeline is closed)
+            **/
+            bool push(Vector<In>& xio_chunk) {
+                while (!try_push(xio_chunk)) {
+                    if (m_closed.load()) return false;
+
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_blocked.fetch_add(1);
+                    m_space.wait(lock, [this]() {
+                        const std::size_t position{ m_head.load() };
+                        return m_closed.load() || (slot(position).sequence.load() >= 4 * position);
+                    });
+                    m_blocked.fetch_sub(1);
+                }
+                return true;
+            }
+
+            bool push(Vector<In>&& xi_chunk) {
+                return push(xi_chunk);
+            }
+
+            // stop accepting chunks - consumers drain the chunks already pushed, then pop returns false
+            void close() {
+                m_closed.store(true);
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_space.notify_all();
+                }
+                Evaluation::scheduler().notify();
+            }
+
+        // consumer side
+        public:
+
+            /**
+            * \brief pop the next result if it is ready (the result is exchanged with the given buffer).
+            *        rethrows an exception the stage threw for that chunk (the result is consumed).
+            *
+            * @param {Out,  in|out} result
+            * @param {bool, out}    was a result popped?
+            **/
+            bool try_pop(Out& xio_result) {
+                std::size_t position{ m_tail.load() };
+                for (;;) {
+                    Slot& current{ slot(position) };
+                    const std::size_t sequence{ current.sequence.load() };
+                    if (sequence < 4 * position + Ready) return false;
+
+                    if (sequence == 4 * position + Ready) {
+                        if (m_tail.compare_exchange_weak(position, position + 1)) break;
+                    }
+                    else {
+                        position = m_tail.load();
+                    }
+                }
+
+                Slot& claimed{ slot(position) };
+                std::exception_ptr error;
+                std::swap(error, claimed.error);
+                std::swap(xio_result, claimed.output);
+                claimed.sequence.store(4 * (position + m_slots.size()) + Free);
+
+                if (m_blocked.load() > 0) {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_space.notify_all();
+                }
+                if (error) std::rethrow_exception(error);
+                return true;
+            }
+
+            /**
+            * \brief pop the next result, waiting (and executing queued tasks) until it is ready
+            *
+            * @param {Out,  in|out} result
+            * @param {bool, out}    was a result popped? (false once the pipeline is closed and all results were popped)
+            **/
+            bool pop(Out& xio_result) {
+                for (;;) {
+                    if (try_pop(xio_result)) return true;
+                    if (m_closed.load() && (m_tail.load() == m_head.load())) return false;
+                    Evaluation::scheduler().help_until([this]() { return poppable(); });
+                }
+            }
+
+        // queries
+        public:
+            std::size_t chunk_size() const noexcept { return m_chunk; }
+            std::size_t capacity() const noexcept { return m_slots.size(); }
+
+            // amount of chunks pushed and not yet popped
+            std::size_t size() const noexcept {
+                const std::size_t tail{ m_tail.load() };
+                return m_head.load() - tail;
+            }
+            bool closed() const noexcept { return m_closed.load(); }
+    };
+
+    /**
+    * bit manipulation helpers (used by selection bitmaps)
+    **/
+    namespace BitOperations {
+
+        // number of set bits in a word
+        inline std::size_t popcount(std::uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<std::size_t>(__builtin_popcountll(x));
+#else
+            std::size_t count{};
+            for (; x != 0; x &= x - 1) {
+                ++count;
+            }
+            return count;
+#endif
+        }
+
+        // index of lowest set bit in a (non zero) word
+        inline std::size_t lowest_set_bit(std::uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<std::size_t>(__builtin_ctzll(x));
+#else
+            std::size_t index{};
+            for (; (x & 1) == 0; x >>= 1) {
+                ++index;
+            }
+            return index;
+#endif
+        }
+    };
+
+    /**
+    * \brief predicate evaluation over vector blocks using zone maps.
+    *        a predicate of the form 'vector <relation> scalar' (and conjunction/disjunction of such predicates)
+    *        is classified per block as never/always/maybe holding, according to the vectors zone maps.
+    **/
+    namespace ZoneMapPredicates {
+
+        // predicate status over a block
+        enum class Match { None, All, Some };
+
+        // generic predicate - can not be classified
+        template<typename Predicate> struct Classifier {
+            static constexpr bool enabled{ false };
+            static std::size_t block_size(const Predicate&) { return 0; }
+            static Match classify(const Predicate&, std::size_t, std::size_t) { return Match::Some; }
+        };
+
+        // relation against block minimum/maximum
+        template<typename Operation> struct Relation;
+        template<typename T> struct Relation<BinaryOperations::LT<T>> {
+            static Match classify(const T& lo, const T& hi, const T& c) { return (hi < c) ? Match::All : (!(lo < c) ? Match::None : Match::Some); }
+        };
+        template<typename T> struct Relation<BinaryOperations::LE<T>> {
+            static Match classify(const T& lo, const T& hi, const T& c) { return (hi <= c) ? Match::All : (!(lo <= c) ? Match::None : Match::Some); }
+        };
+        template<typename T> struct Relation<BinaryOperations::GT<T>> {
+            static Match classify(const T& lo, const T& hi, const T& c) { return (lo > c) ? Match::All : (!(hi > c) ? Match::None : Match::Some); }
+        };
+        template<typename T> struct Relation<BinaryOperations::GE<T>> {
+            static Match classify(const T& lo, const T& hi, const T& c) { return (lo >= c) ? Match::All : (!(hi >= c) ? Match::None : Match::Some); }
+        };
+        template<typename T> struct Relation<BinaryOperations::EQ<T>> {
+            static Match classify(const T& lo, const T& hi, const T& c) { return ((lo == c) && (hi == c)) ? Match::All : (((c < lo) || (hi < c)) ? Match::None : Match::Some); }
+        };
+        template<typename T> struct Relation<BinaryOperations::NEQ<T>> {
+            static Match classify(const T& lo, const T& hi, const T& c) { return ((c < lo) || (hi < c)) ? Match::All : (((lo == c) && (hi == c)) ? Match::None : Match::Some); }
+        };
+
+        // 'vector <relation> scalar'
+        template<typename T, template<typename> class Operation, typename S> struct Classifier<BinaryExpression<const Vector<T>&, Operation<T>, S>> {
+            using Predicate = BinaryExpression<const Vector<T>&, Operation<T>, S>;
+            static constexpr bool enabled{ std::is_same<typename std::decay<S>::type, Scalar<T>>::value };
+
+            static std::size_t block_size(const Predicate& xi_predicate) {
+                if constexpr (enabled) {
+                    const ZoneMap<T>* zone{ xi_predicate.le().zone_map() };
+                    return (zone != nullptr) ? zone->block_size() : 0;
+                }
+                else {
+                    return 0;
+                }
+            }
+
+            static Match classify(const Predicate& xi_predicate, const std::size_t xi_first, const std::size_t xi_last) {
+                if constexpr (enabled) {
+                    const ZoneMap<T>* zone{ xi_predicate.le().zone_map() };
+                    if (zone == nullptr) return Match::Some;
+
+                    T lo, hi;
+                    zone->bounds(xi_first, xi_last, lo, hi);
+                    return Relation<Operation<T>>::classify(lo, hi, xi_predicate.re().value());
+                }
+                else {
+                    return Match::Some;
+                }
+            }
+        };
+
+        // combine the block sizes of two sub predicates
+        inline std::size_t combine_block_size(const std::size_t a, const std::size_t b) noexcept {
+            if (a == 0) return b;
+            if (b == 0) return a;
+            return (a < b) ? a : b;
+        }
+
+        // 'predicate && predicate'
+        template<typename L, typename T, typename R> struct Classifier<BinaryExpression<L, BinaryOperations::AND<T>, R>> {
+            using Predicate = BinaryExpression<L, BinaryOperations::AND<T>, R>;
+            using Left = Classifier<typename std::decay<L>::type>;
+            using Right = Classifier<typename std::decay<R>::type>;
+            static constexpr bool enabled{ Left::enabled || Right::enabled };
+
+            static std::size_t block_size(const Predicate& xi_predicate) {
+                return combine_block_size(Left::block_size(xi_predicate.le()), Right::block_size(xi_predicate.re()));
+            }
+
+            static Match classify(const Predicate& xi_predicate, const std::size_t xi_first, const std::size_t xi_last) {
+                const Match left{ Left::classify(xi_predicate.le(), xi_first, xi_last) };
+                if (left == Match::None) return Match::None;
+
+                const Match right{ Right::classify(xi_predicate.re(), xi_first, xi_last) };
+                if (right == Match::None) return Match::None;
+                return ((left == Match::All) && (right == Match::All)) ? Match::All : Match::Some;
+            }
+        };
+
+        // 'predicate || predicate'
+        template<typename L, typename T, typename R> struct Classifier<BinaryExpression<L, BinaryOperations::OR<T>, R>> {
+            using Predicate = BinaryExpression<L, BinaryOperations::OR<T>, R>;
+            using Left = Classifier<typename std::decay<L>::type>;
+            using Right = Classifier<typename std::decay<R>::type>;
+            static constexpr bool enabled{ Left::enabled || Right::enabled };
+
+            static std::size_t block_size(const Predicate& xi_predicate) {
+                return combine_block_size(Left::block_size(xi_predicate.le()), Right::block_size(xi_predicate.re()));
+            }
+
+            static Match classify(const Predicate& xi_predicate, const std::size_t xi_first, const std::size_t xi_last) {
+                const Match left{ Left::classify(xi_predicate.le(), xi_first, xi_last) };
+                if (left == Match::All) return Match::All;
+
+                const Match right{ Right::classify(xi_predicate.re(), xi_first, xi_last) };
+                if (right == Match::All) return Match::All;
+                return ((left == Match::None) && (right == Match::None)) ? Match::None : Match::Some;
+            }
+        };
+    };
+
+    /**
+    * \brief a set of selected vector positions (i.e. - the positions which survived a predicate).
+    *        a selection is held either as a bitmap (dense) or as an ascending list of indices (sparse),
+    *        the representation is chosen by the selection selectivity (ratio of selected positions).
+    **/
+    class Selection {
+        // a selection whose selectivity is below this ratio is held (and evaluated) as a list of indices,
+        // above it, it is held as a bitmap and evaluated densely, word by word.
+        static constexpr double SparseSelectivity{ 0.125 };
+
+        // properties
+        private:
+            std::size_t m_size{};                   // length of the vector the selection refers to
+            std::size_t m_count{};                  // amount of selected positions
+            std::vector<std::uint64_t> m_bitmap;    // dense representation (bit i is set if position i is selected)
+            std::vector<std::size_t> m_indices;     // sparse representation (ascending selected positions)
+
+        // internal methods
+        private:
+
+            // choose representation according to selectivity
+            void compact() {
+                if (is_sparse_selectivity()) {
+                    m_indices.clear();
+                    m_indices.reserve(m_count);
+                    for (std::size_t w{}; w < m_bitmap.size(); ++w) {
+                        for (std::uint64_t word{ m_bitmap[w] }; word != 0; word &= word - 1) {
+                            m_indices.push_back(w * 64 + BitOperations::lowest_set_bit(word));
+                        }
+                    }
+                    m_bitmap.clear();
+                    m_bitmap.shrink_to_fit();
+                }
+            }
+
+            bool is_sparse_selectivity() const noexcept {
+                return static_cast<double>(m_count) < SparseSelectivity * static_cast<double>(m_size);
+            }
+
+        // constructors
+        public:
+
+            // empty selection
+            Selection() = default;
+
+            // construct a selection from a bitmap (64 positions per word, bit i of word w refers to position 64 * w + i)
+            static Selection from_bitmap(const std::size_t xi_size, std::vector<std::uint64_t> xi_bitmap) {
+                Selection selection;
+                selection.m_size = xi_size;
+                selection.m_bitmap = std::move(xi_bitmap);
+                selection.m_bitmap.resize((xi_size + 63) / 64, 0);
+                if ((xi_size % 64) != 0) {
+                    selection.m_bitmap.back() &= (std::uint64_t{ 1 } << (xi_size % 64)) - 1;
+                }
+
+                for (const std::uint64_t word : selection.m_bitmap) {
+                    selection.m_count += BitOperations::popcount(word);
+                }
+                selection.compact();
+
+                return selection;
+            }
+
+            // construct a selection from a list of ascending indices
+            static Selection from_indices(const std::size_t xi_size, std::vector<std::size_t> xi_indices) {
+                assert(std::is_sorted(xi_indices.begin(), xi_indices.end()));
+                assert(xi_indices.empty() || (xi_indices.back() < xi_size));
+
+                Selection selection;
+                selection.m_size = xi_size;
+                selection.m_count = xi_indices.size();
+                selection.m_indices = std::move(xi_indices);
+
+                if (!selection.is_sparse_selectivity()) {
+                    selection.m_bitmap.assign((xi_size + 63) / 64, 0);
+                    for (const std::size_t i : selection.m_indices) {
+                        selection.m_bitmap[i / 64] |= std::uint64_t{ 1 } << (i % 64);
+                    }
+                    selection.m_indices.clear();
+                    selection.m_indices.shrink_to_fit();
+                }
+
+                return selection;
+            }
+
+            // construct a selection from a predicate (an expression or a vector whose elements are convertible to bool)
+            // (if predicate operands maintain zone maps, blocks which can not match are skipped and blocks which fully match are filled without any test)
+            template<typename Predicate> static Selection from_predicate(const Predicate& xi_predicate) {
+                using Classifier = ZoneMapPredicates::Classifier<Predicate>;
+                const std::size_t len{ xi_predicate.size() };
+                std::vector<std::uint64_t> bitmap((len + 63) / 64, 0);
+
+                // evaluate predicate over words [first, last)
+                auto evaluate = [&xi_predicate, &bitmap, len](const std::size_t xi_first, const std::size_t xi_last) {
+                    for (std::size_t w{ xi_first }; w < xi_last; ++w) {
+                        const std::size_t first{ w * 64 },
+                                          last{ (first + 64 < len) ? first + 64 : len };
+                        std::uint64_t word{};
+                        for (std::size_t i{ first }; i < last; ++i) {
+                            word |= static_cast<std::uint64_t>(static_cast<bool>(Operands::at(xi_predicate, i))) << (i - first);
+                        }
+                        bitmap[w] = word;
+                    }
+                };
+
+                // block size (in words) over which predicate can be classified
+                std::size_t blockWords{};
+                if constexpr (Classifier::enabled) {
+                    blockWords = (Classifier::block_size(xi_predicate) + 63) / 64;
+                }
+
+                if (blockWords == 0) {
+                    evaluate(0, bitmap.size());
+                }
+                else {
+                    for (std::size_t w{}; w < bitmap.size(); w += blockWords) {
+                        const std::size_t last{ (w + blockWords < bitmap.size()) ? w + blockWords : bitmap.size() },
+                                          lastPosition{ (last * 64 < len) ? last * 64 : len };
+
+                        switch (Classifier::classify(xi_predicate, w * 64, lastPosition)) {
+                            case ZoneMapPredicates::Match::None:
+                                break;
+                            case ZoneMapPredicates::Match::All:
+                                std::fill(bitmap.begin() + w, bitmap.begin() + last, ~std::uint64_t{});
+                                break;
+                            case ZoneMapPredicates::Match::Some:
+                                evaluate(w, last);
+                                break;
+                        }
+                    }
+                }
+
+                return from_bitmap(len, std::move(bitmap));
+            }
+
+        // queries
+        public:
+
+            // length of the vector the selection refers to
+            std::size_t size() const noexcept { return m_size; }
+
+            // amount of selected positions
+            std::size_t count() const noexcept { return m_count; }
+
+            // ratio of selected positions
+            double selectivity() const noexcept { return (m_size == 0) ? 0.0 : static_cast<double>(m_count) / static_cast<double>(m_size); }
+
+            // is selection held as a list of indices?
+            bool is_sparse() const noexcept { return m_bitmap.empty() && (m_size > 0); }
+
+            // is a given position selected?
+            bool contains(const std::size_t xi_index) const {
+                if (xi_index >= m_size) return false;
+                if (is_sparse()) return std::binary_search(m_indices.begin(), m_indices.end(), xi_index);
+                return ((m_bitmap[xi_index / 64] >> (xi_index % 64)) & 1) != 0;
+            }
+
+            // underlying representations (only one of them is populated)
+            const std::vector<std::uint64_t>& bitmap() const noexcept { return m_bitmap; }
+            const std::vector<std::size_t>& indices() const noexcept { return m_indices; }
+
+        // iteration
+        public:
+
+            /**
+            * \brief invoke a function on every selected position (in ascending order)
+            *
+            * @param {Function, in} function(std::size_t index)
+            **/
+            template<typename Function> void for_each(Function&& xi_function) const {
+                if (is_sparse()) {
+                    for (const std::size_t i : m_indices) {
+                        xi_function(i);
+                    }
+                    return;
+                }
+
+                for (std::size_t w{}; w < m_bitmap.size(); ++w) {
+                    for (std::uint64_t word{ m_bitmap[w] }; word != 0; word &= word - 1) {
+                        xi_function(w * 64 + BitOperations::lowest_set_bit(word));
+                    }
+                }
+            }
+
+            /**
+            * \brief invoke functions on selected positions, choosing between dense (word by word) and sparse (index by index) traversal.
+            *        in dense traversal, fully selected words are handed over as contiguous ranges (so they can be evaluated without any test),
+            *        partially selected words are tested bit by bit and empty words are skipped.
+            *
+            * @param {RangeFunction, in} function(std::size_t first, std::size_t last) - invoked on a contiguous range of selected positions
+            * @param {IndexFunction, in} function(std::size_t index) - invoked on a single selected position
+            **/
+            template<typename RangeFunction, typename IndexFunction> void visit(RangeFunction&& xi_range, IndexFunction&& xi_index) const {
+                if (is_sparse()) {
+                    for (const std::size_t i : m_indices) {
+                        xi_index(i);
+                    }
+                    return;
+                }
+
+                for (std::size_t w{}; w < m_bitmap.size(); ++w) {
+                    const std::uint64_t word{ m_bitmap[w] };
+                    const std::size_t first{ w * 64 };
+
+                    if (word == ~std::uint64_t{}) {
+                        xi_range(first, first + 64);
+                    }
+                    else if (word != 0) {
+                        const std::size_t last{ (first + 64 < m_size) ? first + 64 : m_size };
+                        for (std::size_t i{ first }; i < last; ++i) {
+                            if ((word >> (i - first)) & 1) {
+                                xi_index(i);
+                            }
+                        }
+                    }
+                }
+            }
+    };
+
+    /**
+    * \brief build a selection out of a predicate expression (i.e. - Lazy::select(a > b))
+    *
+    * @param {Predicate, in} predicate expression
+    * @param {Selection, out} selection of all positions in which predicate holds
+    **/
+    template<typename Predicate> Selection select(const Predicate& xi_predicate) {
+        Async::readable(xi_predicate);
+        return Selection::from_predicate(xi_predicate);
+    }
+
+    /**
+    * \brief evaluate an expression only at selected positions of a destination vector (other positions are left untouched)
+    *
+    * @param {Vector,     in|out} destination vector
+    * @param {Expression, in}     expression
+    * @param {Selection,  in}     selected positions
+    **/
+    template<typename T, typename Expression> void eval(Vector<T>& xi_destination, const Expression& xi_expression, const Selection& xi_selection) {
+        assert(xi_selection.size() <= xi_destination.size());
+        assert(xi_selection.size() <= xi_expression.size());
+        Async::readable(xi_expression);
+
+        T* destination{ xi_destination.data() };
+        xi_selection.visit([destination, &xi_expression](const std::size_t first, const std::size_t last) {
+                               for (std::size_t i{ first }; i < last; ++i) {
+                                   destination[i] = Operands::at(xi_expression, i);
+                               }
+                           },
+                           [destination, &xi_expression](const std::size_t i) {
+                               destination[i] = Operands::at(xi_expression, i);
+                           });
+    }
+
+    /**
+    * \brief reduce an expression (or vector) with an associative binary operation
+    *
+    * @param {Expression, in}  expression
+    * @param {T,          in}  initial value
+    * @param {Operation,  in}  associative binary operation
+    * @param {Site,       in}  call site (profiling)
+    * @param {T,          out} reduction result
+    **/
+    template<typename Expression, typename T, typename Operation> T reduce(const Expression& xi_expression, T xi_initial, Operation xi_operation,
+                                                                           const Profiling::Site xi_site = Profiling::Site::current()) {
+#if defined(LAZY_VECTOR_PROFILING)
+        const auto start{ std::chrono::steady_clock::now() };
+        T out{ Evaluation::reduce(xi_expression, 0, xi_expression.size(), std::move(xi_initial), std::move(xi_operation)) };
+        Profiling::expression<typename std::decay<Expression>::type>(xi_site, "reduce", start, std::chrono::steady_clock::now(), xi_expression.size());
+        return out;
+#else
+        (void)xi_site;
+        return Evaluation::reduce(xi_expression, 0, xi_expression.size(), std::move(xi_initial), std::move(xi_operation));
+#endif
+    }
+
+    /**
+    * \brief sum of an expression (or vector) elements
+    *
+    * @param {Expression, in}  expression
+    * @param {Site,       in}  call site (profiling)
+    * @param {value_type, out} sum
+    **/
+    template<typename Expression> auto sum(const Expression& xi_expression, const Profiling::Site xi_site = Profiling::Site::current()) -> typename std::decay<Expression>::type::value_type {
+        using T = typename std::decay<Expression>::type::value_type;
+        return reduce(xi_expression, T{}, [](const T& a, const T& b) { return a + b; }, xi_site);
+    }
+
+    /**
+    * \brief evaluate 'destination = expression' over the destination size with a given execution policy (Lazy::Execution)
+    *        instead of the evaluator choice, i.e. - Lazy::eval(Lazy::Execution::par_unseq, c, a * b + a)
+    *
+    * @param {Policy,     in}     execution policy
+    * @param {Vector,     in|out} destination vector
+    * @param {Expression, in}     expression
+    **/
+    template<typename Policy, typename T, typename Expression, typename std::enable_if<Execution::is_policy<Policy>()>::type* = nullptr>
+    void eval(const Policy&, Vector<T>& xi_destination, const Expression& xi_expression) {
+        T* destination{ xi_destination.data() };
+        Async::readable(xi_expression);
+        Evaluation::run<typename std::decay<Policy>::type, AssignOperations::ASSIGN>(destination, xi_expression, 0, xi_destination.size());
+    }
+
+    /**
+    * \brief reduce an expression (or vector) with a given execution policy (Lazy::Execution).
+    *        unsequenced policies reduce arithmetic types out of order, so the operation should be commutative as well.
+    *
+    * @param {Policy,     in}  execution policy
+    * @param {Expression, in}  expression
+    * @param {T,          in}  initial value
+    * @param {Operation,  in}  associative binary operation
+    * @param {Site,       in}  call site (profiling)
+    * @param {T,          out} reduction result
+    **/
+    template<typename Policy, typename Expression, typename T, typename Operation, typename std::enable_if<Execution::is_policy<Policy>()>::type* = nullptr>
+    T reduce(const Policy&, const Expression& xi_expression, T xi_initial, Operation xi_operation, const Profiling::Site xi_site = Profiling::Site::current()) {
+        using P = typename std::decay<Policy>::type;
+#if defined(LAZY_VECTOR_PROFILING)
+        const auto start{ std::chrono::steady_clock::now() };
+        T out{ Evaluation::reduce<P>(xi_expression, 0, xi_expression.size(), std::move(xi_initial), std::move(xi_operation)) };
+        Profiling::expression<typename std::decay<Expression>::type>(xi_site, "reduce", start, std::chrono::steady_clock::now(), xi_expression.size());
+        return out;
+#else
+        (void)xi_site;
+        return Evaluation::reduce<P>(xi_expression, 0, xi_expression.size(), std::move(xi_initial), std::move(xi_operation));
+#endif
+    }
+
+    // sum of an expression (or vector) elements with a given execution policy (Lazy::Execution)
+    template<typename Policy, typename Expression, typename std::enable_if<Execution::is_policy<Policy>()>::type* = nullptr>
+    auto sum(const Policy& xi_policy, const Expression& xi_expression, const Profiling::Site xi_site = Profiling::Site::current()) -> typename std::decay<Expression>::type::value_type {
+        using T = typename std::decay<Expression>::type::value_type;
+        return reduce(xi_policy, xi_expression, T{}, [](const T& a, const T& b) { return a + b; }, xi_site);
+    }
+
+    /**
+    * \brief inclusive scan of an expression into a destination, over the destination size, with a given execution policy (Lazy::Execution):
+    *        destination[i] = operation(...operation(expression[0], expression[1])..., expression[i])
+    *
+    * @param {Policy,     in}     execution policy
+    * @param {Vector,     in|out} destination vector (may be an operand of the expression)
+    * @param {Expression, in}     expression
+    * @param {Operation,  in}     associative binary operation (default is addition)
+    **/
+    template<typename Policy, typename T, typename Expression, typename Operation = std::plus<T>, typename std::enable_if<Execution::is_policy<Policy>()>::type* = nullptr>
+    void inclusive_scan(const Policy&, Vector<T>& xi_destination, const Expression& xi_expression, Operation xi_operation = Operation{}) {
+        T* destination{ xi_destination.data() };
+        Evaluation::scan<typename std::decay<Policy>::type, true>(destination, xi_expression, 0, xi_destination.size(), T{}, false, std::move(xi_operation));
+    }
+
+    /**
+    * \brief exclusive scan of an expression into a destination, over the destination size, with a given execution policy (Lazy::Execution):
+    *        destination[i] = operation(...operation(initial, expression[0])..., expression[i - 1])
+    *
+    * @param {Policy,     in}     execution policy
+    * @param {Vector,     in|out} destination vector (may be an operand of the expression)
+    * @param {Expression, in}     expression
+    * @param {T,          in}     initial value
+    * @param {Operation,  in}     associative binary operation (default is addition)
+    **/
+    template<typename Policy, typename T, typename Expression, typename Operation = std::plus<T>, typename std::enable_if<Execution::is_policy<Policy>()>::type* = nullptr>
+    void exclusive_scan(const Policy&, Vector<T>& xi_destination, const Expression& xi_expression, const typename Vector<T>::value_type& xi_initial, Operation xi_operation = Operation{}) {
+        T* destination{ xi_destination.data() };
+        Evaluation::scan<typename std::decay<Policy>::type, false>(destination, xi_expression, 0, xi_destination.size(), xi_initial, true, std::move(xi_operation));
+    }
+
+    /**
+    * \brief sort a vector with a given execution policy (Lazy::Execution) - parallel policies sort a run per thread on the
+    *        work stealing scheduler, then merge pairs of runs in parallel rounds (the sort is not stable)
+    *
+    * @param {Policy,  in}     execution policy
+    * @param {Vector,  in|out} vector
+    * @param {Compare, in}     strict weak ordering (default is '<')
+    **/
+    template<typename Policy, typename T, typename Compare = std::less<T>, typename std::enable_if<Execution::is_policy<Policy>()>::type* = nullptr>
+    void sort(const Policy&, Vector<T>& xi_vector, Compare xi_compare = Compare{}) {
+        T* data{ xi_vector.data() };
+        const std::size_t length{ xi_vector.size() };
+
+        // amount of runs - a power of two, up to one per thread (runs are not shorter than a few thousand elements)
+        std::size_t runs{ 1 };
+        if constexpr (Execution::Traits<typename std::decay<Policy>::type>::parallel) {
+            const std::size_t threads{ Evaluation::policy_concurrency() };
+            while ((2 * runs <= threads) && (length / (2 * runs) >= 4096)) {
+                runs *= 2;
+            }
+        }
+        if (runs == 1) {
+            std::sort(data, data + length, xi_compare);
+            return;
+        }
+
+        Evaluation::Scheduler& scheduler{ Evaluation::scheduler() };
+        const std::size_t run{ (length + runs - 1) / runs };
+        scheduler.run(0, runs, 1, [&](const std::size_t xi_from, const std::size_t xi_to) {
+            for (std::size_t i{ xi_from }; i < xi_to; ++i) {
+                std::sort(data + std::min(length, i * run), data + std::min(length, (i + 1) * run), xi_compare);
+            }
+        }, nullptr, runs);
+
+        for (std::size_t width{ run }; width < length; width *= 2) {
+            scheduler.run(0, (length + 2 * width - 1) / (2 * width), 1, [&](const std::size_t xi_from, const std::size_t xi_to) {
+                for (std::size_t i{ xi_from }; i < xi_to; ++i) {
+                    const std::size_t first{ i * 2 * width },
+                                      middle{ std::min(length, first + width) },
+                                      last{ std::min(length, first + 2 * width) };
+                    std::inplace_merge(data + first, data + middle, data + last, xi_compare);
+                }
+            }, nullptr, runs);
+        }
+    }
+
+    /**
+    * \brief assign a value to all vector elements with a given execution policy (Lazy::Execution)
+    *
+    * @param {Policy, in}     execution policy
+    * @param {Vector, in|out} vector
+    * @param {T,      in}     value
+    **/
+    template<typename Policy, typename T, typename std::enable_if<Execution::is_policy<Policy>()>::type* = nullptr>
+    void fill(const Policy& xi_policy, Vector<T>& xi_vector, const typename Vector<T>::value_type& xi_value) {
+        eval(xi_policy, xi_vector, scalar(xi_value));
+    }
+
+    /**
+    * \brief evaluate 'destination = expression' over the destination size unless cancelled (or the cancellation deadline passes), i.e. -
+    *
+    *        const bool completed{ Lazy::eval(c, a * b + a, Lazy::Cancellation::after(std::chrono::milliseconds(5))) };
+    *
+    *        the destination is evaluated in grain sized chunks and the cancellation is checked before every chunk (an atomic load,
+    *        and a clock read only while a deadline is set). once cancelled, no further chunk is started - every chunk of the destination
+    *        is left either fully evaluated or untouched. chunks evaluated sequentially form a prefix of the destination, chunks evaluated
+    *        in parallel need not.
+    *
+    * @param {Vector,       in|out} destination vector
+    * @param {Expression,   in}     expression
+    * @param {Cancellation, in}     cancellation
+    * @param {bool,         out}    was the whole destination evaluated?
+    **/
+    template<typename T, typename Expression> bool eval(Vector<T>& xi_destination, const Expression& xi_expression, const Cancellation& xi_cancellation) {
+        T* destination{ xi_destination.data() };
+        Async::readable(xi_expression);
+        return Evaluation::run<AssignOperations::ASSIGN>(destination, xi_expression, 0, xi_destination.size(), xi_cancellation);
+    }
+
+    // evaluate 'destination = expression' over the destination size with a given execution policy (Lazy::Execution) unless cancelled (as the above)
+    template<typename Policy, typename T, typename Expression, typename std::enable_if<Execution::is_policy<Policy>()>::type* = nullptr>
+    bool eval(const Policy&, Vector<T>& xi_destination, const Expression& xi_expression, const Cancellation& xi_cancellation) {
+        T* destination{ xi_destination.data() };
+        Async::readable(xi_expression);
+        return Evaluation::run<typename std::decay<Policy>::type, AssignOperations::ASSIGN>(destination, xi_expression, 0, xi_destination.size(), xi_cancellation);
+    }
+
+    /**
+    * \brief reduce an expression (or vector) with an associative binary operation unless cancelled (or the cancellation deadline passes).
+    *        the cancellation is checked before every grain sized piece.
+    *
+    * @param {Expression,   in}  expression
+    * @param {T,            in}  initial value
+    * @param {Operation,    in}  associative binary operation
+    * @param {Cancellation, in}  cancellation
+    * @param {optional,     out} reduction result (nothing if cancelled before all pieces were reduced)
+    **/
+    template<typename Expression, typename T, typename Operation> std::optional<T> reduce(const Expression& xi_expression, T xi_initial, Operation xi_operation,
+                                                                                          const Cancellation& xi_cancellation) {
+        return Evaluation::reduce<void>(xi_expression, 0, xi_expression.size(), std::move(xi_initial), std::move(xi_operation), xi_cancellation);
+    }
+
+    // reduce an expression (or vector) with a given execution policy (Lazy::Execution) unless cancelled (as the above)
+    template<typename Policy, typename Expression, typename T, typename Operation, typename std::enable_if<Execution::is_policy<Policy>()>::type* = nullptr>
+    std::optional<T> reduce(const Policy&, const Expression& xi_expression, T xi_initial, Operation xi_operation, const Cancellation& xi_cancellation) {
+        return Evaluation::reduce<typename std::decay<Policy>::type>(xi_expression, 0, xi_expression.size(), std::move(xi_initial), std::move(xi_operation), xi_cancellation);
+    }
+
+    // sum of an expression (or vector) elements unless cancelled (nothing if cancelled)
+    template<typename Expression> auto sum(const Expression& xi_expression, const Cancellation& xi_cancellation) -> std::optional<typename std::decay<Expression>::type::value_type> {
+        using T = typename std::decay<Expression>::type::value_type;
+        return reduce(xi_expression, T{}, [](const T& a, const T& b) { return a + b; }, xi_cancellation);
+    }
+
+    /**
+    * \brief queue an assignment 'destination = expression' for asynchronous evaluation over the current destination size.
+    *        the expression is given by a generator (as in Lazy::materialize), since expressions refer to their sub expressions
+    *        and would not outlive the call. the destination and all operand vectors are marked pending until it completes:
+    *
+    *        std::shared_future<void> done{ Lazy::async_eval(c, [&](auto&& sink) { sink(a * b + a); }) };
+    *        ... (unrelated work)
+    *        c.wait();               // (element access does not wait, bulk access such as data() and evaluations do)
+    *        float x{ c[0] };
+    *
+    * @param {Vector,        in|out} destination vector
+    * @param {Generator,     in}     function(sink) which invokes sink with the expression
+    * @param {shared_future, out}    completes when the assignment was evaluated (holding any exception it threw)
+    **/
+    template<typename T, typename Generator> std::shared_future<void> async_eval(Vector<T>& xi_destination, Generator xi_generator) {
+        const std::shared_ptr<std::promise<void>> promise{ std::make_shared<std::promise<void>>() };
+        const std::shared_future<void> future{ promise->get_future().share() };
+
+        xi_generator([&future](const auto& xi_expression) {
+            ExpressionTraits::for_each_leaf(xi_expression, [&future](const auto& xi_leaf) { Async::Access::pend(xi_leaf, future, false); });
+        });
+        Async::Access::pend(xi_destination, future, true);
+
+        T* destination{ Async::Access::target(xi_destination) };
+        const std::size_t length{ xi_destination.size() };
+        Async::executor().submit([promise, xi_generator, destination, length]() mutable {
+            try {
+                xi_generator([destination, length](const auto& xi_expression) {
+                    Evaluation::run<AssignOperations::ASSIGN>(destination, xi_expression, 0, length);
+                });
+                promise->set_value();
+            }
+            catch (...) {
+                promise->set_exception(std::current_exception());
+            }
+        });
+
+        return future;
+    }
+
+#if defined(LAZY_VECTOR_COROUTINES)
+    /**
+    * \brief an assignment evaluated incrementally, chunk by chunk - a coroutine which suspends after every chunk.
+    *        it is driven either by resume() calls (i.e. - once per event loop iteration) or by the awaitable it suspends on.
+    **/
+    class Incremental {
+        public:
+            struct promise_type {
+                std::size_t done{};             // elements evaluated
+                std::size_t total{};            // elements to evaluate
+                bool cancelled{ false };
+                std::exception_ptr error;
+
+                Incremental get_return_object() noexcept { return Incremental(std::coroutine_handle<promise_type>::from_promise(*this)); }
+                std::suspend_always initial_suspend() const noexcept { return {}; }
+                std::suspend_always final_suspend() const noexcept { return {}; }
+                void return_void() const noexcept {}
+                void unhandled_exception() noexcept { error = std::current_exception(); }
+            };
+
+            // awaiting it (without suspending) yields the coroutine promise, so the coroutine body can report progress
+            struct Self {
+                promise_type* promise{ nullptr };
+
+                bool await_ready() const noexcept { return false; }
+                bool await_suspend(const std::coroutine_handle<promise_type> xi_handle) noexcept {
+                    promise = &xi_handle.promise();
+                    return false;
+                }
+                promise_type& await_resume() const noexcept { return *promise; }
+            };
+
+            // default suspension between chunks
+            struct Suspend {
+                std::suspend_always operator()() const noexcept { return {}; }
+            };
+
+        // properties
+        private:
+            std::coroutine_handle<promise_type> m_handle;
+
+        // constructors
+        public:
+            explicit Incremental(const std::coroutine_handle<promise_type> xi_handle) noexcept : m_handle(xi_handle) {}
+
+            Incremental(Incremental&& xi_other) noexcept : m_handle(std::exchange(xi_other.m_handle, {})) {}
+            Incremental& operator=(Incremental&& xi_other) noexcept {
+                if (this != &xi_other) {
+                    if (m_handle) m_handle.destroy();
+                    m_handle = std::exchange(xi_other.m_handle, {});
+                }
+                return *this;
+            }
+
+            Incremental(const Incremental&) = delete;
+            Incremental& operator=(const Incremental&) = delete;
+
+            // destroys the coroutine (an unfinished evaluation is abandoned, it must not be suspended on a foreign awaitable)
+            ~Incremental() {
+                if (m_handle) m_handle.destroy();
+            }
+
+        // operations
+        public:
+
+            /**
+            * \brief evaluate the next chunk
+            *
+            * @param {bool, out} true while more chunks remain (rethrows an exception thrown by the evaluation)
+            **/
+            bool resume() {
+                if (m_handle && !m_handle.done()) {
+                    m_handle.resume();
+                }
+                if (m_handle && m_handle.promise().error) {
+                    std::rethrow_exception(std::exchange(m_handle.promise().error, nullptr));
+                }
+                return !done();
+            }
+
+            // evaluate all remaining chunks
+            void finish() {
+                while (resume()) {}
+            }
+
+        // queries
+        public:
+            bool done() const noexcept { return !m_handle || m_handle.done(); }
+            bool cancelled() const noexcept { return m_handle && m_handle.promise().cancelled; }
+            std::size_t evaluated() const noexcept { return m_handle ? m_handle.promise().done : 0; }
+            std::size_t size() const noexcept { return m_handle ? m_handle.promise().total : 0; }
+    };
+
+    /**
+    * \brief amount of work evaluated between suspensions - a chunk holds 'elements' positions, or if 'time' is given,
+    *        as many slices of 'elements' positions as fit in it (at least one)
+    **/
+    struct Budget {
+        std::size_t elements{ 1 << 16 };
+        std::chrono::nanoseconds time{ 0 };
+    };
+
+    /**
+    * \brief evaluate 'destination = expression' incrementally - a chunk at a time, suspending in between.
+    *        destination and operands should not be modified until evaluation is done (or cancelled).
+    *
+    *        Lazy::Incremental work{ Lazy::eval_incremental(c, [&](auto&& sink) { sink(a * b); }, { 1 << 14, std::chrono::microseconds(200) }) };
+    *        while (work.resume()) {
+    *            ... (other event loop tasks)
+    *        }
+    *
+    * @param {Vector,       in|out} destination vector (evaluated over its current size)
+    * @param {Generator,    in}     function(sink) which invokes sink with the expression (as in Lazy::materialize)
+    * @param {Budget,       in}     chunk budget
+    * @param {Cancellation, in}     cancellation (checked before every chunk, expires at its deadline)
+    * @param {Yield,        in}     function returning the awaitable to suspend on between chunks (std::suspend_always by default,
+    *                               an event loop awaitable which reschedules the coroutine by itself can be given instead)
+    * @param {Incremental,  out}    evaluation coroutine (suspended before its first chunk)
+    **/
+    template<typename T, typename Generator, typename Yield = Incremental::Suspend>
+    Incremental eval_incremental(Vector<T>& xi_destination, Generator xi_generator, const Budget xi_budget = {}, const Cancellation xi_cancellation = {},
+                                 Yield xi_yield = {}) {
+        Incremental::promise_type& promise{ co_await Incremental::Self{} };
+        const std::size_t length{ xi_destination.size() },
+                          slice{ std::max<std::size_t>(1, xi_budget.elements) };
+        promise.total = length;
+
+        for (std::size_t first{}; first < length;) {
+            if (xi_cancellation.cancelled()) {
+                promise.cancelled = true;
+                co_return;
+            }
+
+            // a chunk - slices until the time budget is used
+            const auto start{ std::chrono::steady_clock::now() };
+            do {
+                const std::size_t last{ std::min(length, first + slice) };
+                T* destination{ xi_destination.data() };
+                xi_generator([destination, first, last](const auto& xi_expression) {
+                    Evaluation::evaluate<AssignOperations::ASSIGN>(destination, xi_expression, first, last);
+                });
+                first = last;
+                promise.done = first;
+            } while ((first < length) && (std::chrono::steady_clock::now() - start < xi_budget.time));
+
+            if (first < length) {
+                co_await xi_yield();
+            }
+        }
+    }
+#endif
+
+    /**
+    * \brief gather an expression at selected positions into a compact vector (expression is evaluated only at selected positions)
+    *
+    * @param {Expression, in}  expression
+    * @param {Selection,  in}  selected positions
+    * @param {Vector,     out} vector holding the expression values at selected positions (in ascending position order)
+    **/
+    template<typename Expression> auto gather(const Expression& xi_expression, const Selection& xi_selection) -> Vector<typename std::decay<Expression>::type::value_type> {
+        using T = typename std::decay<Expression>::type::value_type;
+        assert(xi_selection.size() <= xi_expression.size());
+        Async::readable(xi_expression);
+        Vector<T> out(xi_selection.count());
+
+        T* destination{ out.data() };
+        std::size_t j{};
+        xi_selection.visit([destination, &j, &xi_expression](const std::size_t first, const std::size_t last) {
+                               for (std::size_t i{ first }; i < last; ++i, ++j) {
+                                   destination[j] = Operands::at(xi_expression, i);
+                               }
+                           },
+                           [destination, &j, &xi_expression](const std::size_t i) {
+                               destination[j++] = Operands::at(xi_expression, i);
+                           });
+
+        return out;
+    }
+
+    /**
+    * evaluation autotuning - micro benchmarks representative expressions to pick the evaluation settings which suit this host
+    * (tile size, tiling thresholds and parallel work threshold), and persists them in a small profile file so later processes
+    * only load it. a profile is reused only on the host it was measured on (same hardware concurrency and cache sizes).
+    **/
+    namespace Tuning {
+
+        // profile file format version
+        constexpr std::size_t Version{ 1 };
+
+        /**
+        * \brief tuned evaluation settings, and the host they were measured on
+        **/
+        struct Profile {
+            std::size_t tileBytes{ Evaluation::Settings{}.tileBytes };
+            std::size_t tiledStreams{ Evaluation::Settings{}.tiledStreams };
+            std::size_t tiledDepth{ Evaluation::Settings{}.tiledDepth };
+            std::size_t parallelWork{ Evaluation::Settings{}.parallelWork };
+            std::string host;
+        };
+
+        // host signature - hardware concurrency and data cache sizes
+        inline std::string host() {
+            std::string out{ std::to_string(std::thread::hardware_concurrency()) };
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+            out += "-" + std::to_string(sysconf(_SC_LEVEL1_DCACHE_SIZE)) + "-" + std::to_string(sysconf(_SC_LEVEL2_CACHE_SIZE)) +
+                   "-" + std::to_string(sysconf(_SC_LEVEL3_CACHE_SIZE));
+#endif
+            return out;
+        }
+
+        // default profile path - LAZY_VECTOR_PROFILE environment variable, or 'lazy_vector.profile' in the working directory
+        inline std::string default_path() {
+            const char* path{ std::getenv("LAZY_VECTOR_PROFILE") };
+            return ((path != nullptr) && (*path != '\0')) ? std::string(path) : std::string("lazy_vector.profile");
+        }
+
+        // apply a profile to the evaluation settings
+        inline void apply(const Profile& xi_profile) noexcept {
+            Evaluation::Settings& current{ Evaluation::settings() };
+            current.tileBytes = xi_profile.tileBytes;
+            current.tiledStreams = xi_profile.tiledStreams;
+            current.tiledDepth = xi_profile.tiledDepth;
+            current.parallelWork = xi_profile.parallelWork;
+        }
+
+        /**
+        * \brief read a profile file
+        *
+        * @param {string,  in}  path
+        * @param {Profile, out} profile
+        * @param {bool,    out} true if the file exists, has the current format version and was measured on this host
+        **/
+        inline bool load(const std::string& xi_path, Profile& xo_profile) {
+            std::ifstream file(xi_path);
+            if (!file) return false;
+
+            Profile profile;
+            std::size_t version{};
+            std::string line;
+            while (std::getline(file, line)) {
+                std::istringstream fields(line);
+                std::string key;
+                fields >> key;
+                if (key == "version") fields >> version;
+                else if (key == "host") fields >> profile.host;
+                else if (key == "tileBytes") fields >> profile.tileBytes;
+                else if (key == "tiledStreams") fields >> profile.tiledStreams;
+                else if (key == "tiledDepth") fields >> profile.tiledDepth;
+                else if (key == "parallelWork") fields >> profile.parallelWork;
+            }
+
+            if ((version != Version) || (profile.host != host()) || (profile.tileBytes == 0) || (profile.parallelWork == 0)) return false;
+            xo_profile = profile;
+            return true;
+        }
+
+        // write a profile file (returns false if it can not be written)
+        inline bool save(const std::string& xi_path, const Profile& xi_profile) {
+            std::ofstream file(xi_path);
+            file << "version " << Version << "\n"
+                 << "host " << xi_profile.host << "\n"
+                 << "tileBytes " << xi_profile.tileBytes << "\n"
+                 << "tiledStreams " << xi_profile.tiledStreams << "\n"
+                 << "tiledDepth " << xi_profile.tiledDepth << "\n"
+                 << "parallelWork " << xi_profile.parallelWork << "\n";
+            return static_cast<bool>(file);
+        }
+
+        // duration (seconds) of a single invocation of a function - the function is invoked repeatedly for a few samples lasting
+        // at least a given time each, and the shortest average invocation duration of a sample is returned
+        template<typename Function> double time(Function&& xi_function, const double xi_sampleTime = 0.005, const std::size_t xi_samples = 5) {
+            using clock = std::chrono::steady_clock;
+
+            double best{ std::numeric_limits<double>::max() };
+            xi_function();
+            for (std::size_t sample{}; sample < xi_samples; ++sample) {
+                const auto start{ clock::now() };
+                std::size_t invocations{};
+                double elapsed{};
+                do {
+                    xi_function();
+                    ++invocations;
+                    elapsed = std::chrono::duration<double>(clock::now() - start).count();
+                } while (elapsed < xi_sampleTime);
+                best = std::min(best, elapsed / static_cast<double>(invocations));
+            }
+            return best;
+        }
+
+        /**
+        * \brief measure the settings best suited to this host (takes under a second, evaluation settings are restored afterwards).
+        *        a setting departs from its default only when an alternative is clearly faster, so noisy measurements keep the defaults.
+        **/
+        inline Profile measure() {
+            Evaluation::Settings& current{ Evaluation::settings() };
+            const Evaluation::Settings original{ current };
+            Profile profile;
+            profile.host = host();
+
+            // operands - fifteen vectors of a last level cache sized working set (so that tiling matters)
+            constexpr std::size_t length{ 1 << 17 };
+            std::vector<Vector<float>> v;
+            v.reserve(14);
+            for (std::size_t i{}; i < 14; ++i) {
+                v.emplace_back(length, 1.0f + static_cast<float>(i) * 0.125f);
+            }
+            Vector<float> r(length);
+
+            // a left deep sum of a given amount of operands (4, 7, 10 or 14)
+            const auto sum = [&v, &r](const std::size_t xi_streams) {
+                switch (xi_streams) {
+                    case 4:  r = v[0] + v[1] + v[2] + v[3]; break;
+                    case 7:  r = v[0] + v[1] + v[2] + v[3] + v[4] + v[5] + v[6]; break;
+                    case 10: r = v[0] + v[1] + v[2] + v[3] + v[4] + v[5] + v[6] + v[7] + v[8] + v[9]; break;
+                    default: r = v[0] + v[1] + v[2] + v[3] + v[4] + v[5] + v[6] + v[7] + v[8] + v[9] + v[10] + v[11] + v[12] + v[13]; break;
+                }
+            };
+            current.threads = 1;
+
+            // tile size - fastest tiled evaluation of the widest expression (a tile has to be clearly faster than the default one)
+            current.strategy = Evaluation::Strategy::Tiled;
+            current.tileBytes = profile.tileBytes;
+            double best{ time([&sum]() { sum(14); }) };
+            for (std::size_t bytes{ 1024 }; bytes <= 32 * 1024; bytes *= 2) {
+                if (bytes == Evaluation::Settings{}.tileBytes) continue;
+
+                current.tileBytes = bytes;
+                const double duration{ time([&sum]() { sum(14); }) };
+                if (duration < 0.95 * best) {
+                    best = duration;
+                    profile.tileBytes = bytes;
+                }
+            }
+            current.tileBytes = profile.tileBytes;
+
+            // tiling thresholds - narrowest expression (a left deep sum, so its depth is one less than its streams) for which tiled
+            // evaluation clearly beats fused evaluation. if none does, defaults are kept - unless tiling clearly loses at every width,
+            // in which case only expressions wider than the widest measured one are tiled
+            bool loses{ true };
+            for (const std::size_t streams : { 4, 7, 10, 14 }) {
+                current.strategy = Evaluation::Strategy::Tiled;
+                const double tiled{ time([&sum, streams]() { sum(streams); }) };
+                current.strategy = Evaluation::Strategy::Vectorized;
+                const double fused{ time([&sum, streams]() { sum(streams); }) };
+                if (tiled < 0.95 * fused) {
+                    profile.tiledStreams = streams;
+                    profile.tiledDepth = streams - 1;
+                    loses = false;
+                    break;
+                }
+                loses = loses && (tiled > 1.05 * fused);
+            }
+            if (loses) {
+                profile.tiledStreams = 15;
+                profile.tiledDepth = 14;
+            }
+
+            // parallel work - shortest triad for which parallel evaluation is clearly faster (the default is kept if it never is)
+            const std::size_t threads{ std::max<std::size_t>({ 1, std::thread::hardware_concurrency(), original.threads }) };
+            if (threads > 1) {
+                using Triad = decltype(v[0] + v[1] * scalar(2.0f));
+                const std::size_t work{ ExpressionTraits::Cost<float, Triad>::work };
+
+                for (std::size_t len{ 1 << 10 }; len <= (1 << 22); len *= 2) {
+                    Vector<float> a(len, 1.0f), b(len, 2.0f), out(len);
+                    const auto triad = [&]() { out = a + b * scalar(2.0f); };
+
+                    current.strategy = Evaluation::Strategy::Automatic;
+                    current.threads = 1;
+                    const double serial{ time(triad) };
+                    current.strategy = Evaluation::Strategy::Parallel;
+                    current.threads = threads;
+                    current.parallelWork = len * work;
+                    const double parallel{ time(triad) };
+                    if (parallel < 0.8 * serial) {
+                        profile.parallelWork = len * work;
+                        break;
+                    }
+                }
+            }
+
+            current = original;
+            return profile;
+        }
+    };
+
+    /**
+    * \brief load this host's evaluation profile (measuring and saving it first if there is none) and apply it
+    *
+    * @param {string,  in}  profile file path (Tuning::default_path() by default)
+    * @param {bool,    in}  measure even if a profile exists
+    * @param {Profile, out} applied profile
+    **/
+    inline Tuning::Profile tune(const std::string& xi_path = Tuning::default_path(), const bool xi_force = false) {
+        Tuning::Profile profile;
+        if (xi_force || !Tuning::load(xi_path, profile)) {
+            profile = Tuning::measure();
+            Tuning::save(xi_path, profile);
+        }
+
+        Tuning::apply(profile);
+        return profile;
+    }
 };
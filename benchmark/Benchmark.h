@@ -0,0 +1,234 @@
+/**
+* Common benchmark utilities - timing, machine cache sizes and JSON reporting.
+*
+* Dan Israel Malta
+**/
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#include <sys/resource.h>
+#endif
+
+namespace Benchmark {
+
+    /**
+    * \brief data cache sizes (in bytes) of the running machine
+    **/
+    struct CacheSizes {
+        std::size_t l1{ 32 * 1024 };
+        std::size_t l2{ 1024 * 1024 };
+        std::size_t llc{ 32 * 1024 * 1024 };
+    };
+
+    inline CacheSizes cache_sizes() {
+        CacheSizes sizes;
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+        const long l1{ sysconf(_SC_LEVEL1_DCACHE_SIZE) },
+                   l2{ sysconf(_SC_LEVEL2_CACHE_SIZE) },
+                   l3{ sysconf(_SC_LEVEL3_CACHE_SIZE) };
+        if (l1 > 0) sizes.l1 = static_cast<std::size_t>(l1);
+        if (l2 > 0) sizes.l2 = static_cast<std::size_t>(l2);
+        if (l3 > 0) sizes.llc = static_cast<std::size_t>(l3);
+        else if (l2 > 0) sizes.llc = static_cast<std::size_t>(l2);
+#endif
+        return sizes;
+    }
+
+    // process peak resident set size (in bytes, zero when unavailable). this is a high water mark, it never decreases
+    inline std::size_t peak_rss() {
+#if defined(__unix__) || defined(__APPLE__)
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+        return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+        return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif
+#else
+        return 0;
+#endif
+    }
+
+    /**
+    * \brief a memory hierarchy level, and the amount of bytes a benchmark working set should occupy to reside in it
+    **/
+    struct Level {
+        const char* name;
+        std::size_t bytes;
+    };
+
+    /**
+    * \brief working set sizes sweeping L1 -> L2 -> LLC -> DRAM
+    *
+    * @param {size_t, in} maximal working set (DRAM level is four times the LLC, but not above this)
+    * @param {bool,   in} skip DRAM level
+    **/
+    inline std::vector<Level> levels(const std::size_t xi_maximalBytes, const bool xi_skipMemory) {
+        const CacheSizes sizes{ cache_sizes() };
+        std::vector<Level> out{ { "L1",  sizes.l1 / 2 },
+                                { "L2",  sizes.l2 / 2 },
+                                { "LLC", sizes.llc / 2 } };
+        if (!xi_skipMemory) {
+            out.push_back({ "DRAM", std::max(std::min(4 * sizes.llc, xi_maximalBytes), 2 * sizes.l2) });
+        }
+        return out;
+    }
+
+    /**
+    * \brief measure a function - returns the shortest duration (in seconds) of a single invocation,
+    *        invoking it repeatedly until a given amount of time elapsed (and at least a few times)
+    *
+    * @param {Function, in} function to measure
+    * @param {double,   in} minimal amount of time (seconds) to spend measuring
+    **/
+    template<typename Function> double measure(Function&& xi_function, const double xi_minimalTime = 0.05) {
+        using clock = std::chrono::steady_clock;
+
+        // warm up
+        xi_function();
+
+        double best{ -1.0 },
+               total{};
+        for (std::size_t repetition{}; (repetition < 5) || (total < xi_minimalTime); ++repetition) {
+            const auto start{ clock::now() };
+            xi_function();
+            const double duration{ std::chrono::duration<double>(clock::now() - start).count() };
+
+            total += duration;
+            if ((best < 0.0) || (duration < best)) {
+                best = duration;
+            }
+        }
+
+        return best;
+    }
+
+    // prevent the compiler from optimizing away a value
+    template<typename T> void keep(const T& xi_value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(xi_value) : "memory");
+#else
+        static volatile const T* sink;
+        sink = &xi_value;
+#endif
+    }
+
+    /**
+    * \brief a flat JSON record (string and numeric fields, kept in insertion order)
+    **/
+    class Record {
+        // properties
+        private:
+            std::vector<std::pair<std::string, std::string>> m_fields;
+
+        // modifiers
+        public:
+            Record& set(const std::string& xi_key, const std::string& xi_value) {
+                m_fields.emplace_back(xi_key, "\"" + xi_value + "\"");
+                return *this;
+            }
+
+            Record& set(const std::string& xi_key, const char* xi_value) {
+                return set(xi_key, std::string(xi_value));
+            }
+
+            Record& set(const std::string& xi_key, const double xi_value) {
+                char buffer[64];
+                std::snprintf(buffer, sizeof(buffer), "%.6g", xi_value);
+                m_fields.emplace_back(xi_key, buffer);
+                return *this;
+            }
+
+            Record& set(const std::string& xi_key, const std::size_t xi_value) {
+                m_fields.emplace_back(xi_key, std::to_string(xi_value));
+                return *this;
+            }
+
+        // output
+        public:
+            void write(std::ostream& xo_stream) const {
+                xo_stream << "{";
+                for (std::size_t i{}; i < m_fields.size(); ++i) {
+                    xo_stream << (i > 0 ? ", " : "") << "\"" << m_fields[i].first << "\": " << m_fields[i].second;
+                }
+                xo_stream << "}";
+            }
+    };
+
+    /**
+    * \brief a benchmark report - a JSON object holding the machine description and an array of records
+    **/
+    class Report {
+        // properties
+        private:
+            std::string m_name;
+            std::vector<Record> m_records;
+
+        // constructors
+        public:
+            explicit Report(std::string xi_name) : m_name(std::move(xi_name)) {}
+
+        // modifiers
+        public:
+            Record& add() {
+                m_records.emplace_back();
+                return m_records.back();
+            }
+
+        // output
+        public:
+            void write(std::ostream& xo_stream) const {
+                const CacheSizes sizes{ cache_sizes() };
+                xo_stream << "{\n  \"benchmark\": \"" << m_name << "\",\n"
+                          << "  \"machine\": {\"l1\": " << sizes.l1 << ", \"l2\": " << sizes.l2 << ", \"llc\": " << sizes.llc << "},\n"
+                          << "  \"results\": [\n";
+                for (std::size_t i{}; i < m_records.size(); ++i) {
+                    xo_stream << "    ";
+                    m_records[i].write(xo_stream);
+                    xo_stream << ((i + 1 < m_records.size()) ? ",\n" : "\n");
+                }
+                xo_stream << "  ]\n}\n";
+            }
+    };
+
+    /**
+    * \brief minimal command line handling (flags of the form --name or --name=value)
+    **/
+    class Arguments {
+        // properties
+        private:
+            std::vector<std::string> m_arguments;
+
+        // constructors
+        public:
+            Arguments(const int argc, char** argv) : m_arguments(argv + 1, argv + argc) {}
+
+        // queries
+        public:
+            bool has(const std::string& xi_flag) const {
+                return std::find(m_arguments.begin(), m_arguments.end(), "--" + xi_flag) != m_arguments.end();
+            }
+
+            std::string value(const std::string& xi_flag, const std::string& xi_default = "") const {
+                const std::string prefix{ "--" + xi_flag + "=" };
+                for (const std::string& argument : m_arguments) {
+                    if (argument.compare(0, prefix.size(), prefix) == 0) {
+                        return argument.substr(prefix.size());
+                    }
+                }
+                return xi_default;
+            }
+    };
+};
@@ -0,0 +1,286 @@
+/**
+* Container operation benchmark - push_back, emplace_back, insert, erase, resize, reserve, copy, move and swap
+* of Lazy::Vector against std::vector, for a trivial (int32) and a heap owning (std::string) element type, over several sizes.
+* Every measurement reports its duration (ns/element), the heap allocations performed by a single invocation
+* (count, bytes, peak live bytes) and the process peak resident set size, as JSON.
+*
+* build: g++ -std=c++17 -O3 -DNDEBUG -march=native ContainerBenchmark.cpp -o ContainerBenchmark
+* usage: ContainerBenchmark [--quick] [--output=file.json] [--max-elements=count] [--filter=name] [--no-pool]
+*        --quick        - smaller sizes and shorter measurements
+*        --max-elements - largest container size (default 4M)
+*        --filter       - only run operations whose name contains this string
+*        --no-pool      - Lazy::Vector buffers are not recycled (Lazy::Memory::Pool), every buffer is a heap allocation
+*
+* notice that peak RSS is the process high water mark, sizes are swept in increasing order so that it follows the largest size measured so far.
+*
+* Dan Israel Malta
+**/
+#include "../LazyVector.h"
+#include "Benchmark.h"
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    /**
+    * \brief heap allocation statistics, gathered by the global allocation functions below
+    **/
+    struct Allocations {
+        std::size_t count{};    // amount of allocations
+        std::size_t bytes{};    // total allocated bytes
+        std::size_t live{};     // currently allocated bytes
+        std::size_t peak{};     // peak allocated bytes (since last reset)
+    };
+    Allocations allocations;
+
+    // every allocation is preceded by a header holding its size (so that live bytes are known at deallocation)
+    constexpr std::size_t AllocationHeader{ alignof(std::max_align_t) };
+
+    void* allocate(const std::size_t xi_bytes) noexcept {
+        void* block{ std::malloc(xi_bytes + AllocationHeader) };
+        if (block == nullptr) return nullptr;
+
+        *static_cast<std::size_t*>(block) = xi_bytes;
+        ++allocations.count;
+        allocations.bytes += xi_bytes;
+        allocations.live += xi_bytes;
+        allocations.peak = std::max(allocations.peak, allocations.live);
+
+        return static_cast<char*>(block) + AllocationHeader;
+    }
+
+    void deallocate(void* xi_pointer) noexcept {
+        if (xi_pointer == nullptr) return;
+
+        void* block{ static_cast<char*>(xi_pointer) - AllocationHeader };
+        allocations.live -= *static_cast<std::size_t*>(block);
+        std::free(block);
+    }
+}
+
+// global allocation functions (replaced for this program only)
+void* operator new(std::size_t xi_bytes) {
+    if (void* pointer{ allocate(xi_bytes) }) return pointer;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t xi_bytes) {
+    if (void* pointer{ allocate(xi_bytes) }) return pointer;
+    throw std::bad_alloc();
+}
+void* operator new(std::size_t xi_bytes, const std::nothrow_t&) noexcept { return allocate(xi_bytes); }
+void* operator new[](std::size_t xi_bytes, const std::nothrow_t&) noexcept { return allocate(xi_bytes); }
+void operator delete(void* xi_pointer) noexcept { deallocate(xi_pointer); }
+void operator delete[](void* xi_pointer) noexcept { deallocate(xi_pointer); }
+void operator delete(void* xi_pointer, std::size_t) noexcept { deallocate(xi_pointer); }
+void operator delete[](void* xi_pointer, std::size_t) noexcept { deallocate(xi_pointer); }
+void operator delete(void* xi_pointer, const std::nothrow_t&) noexcept { deallocate(xi_pointer); }
+void operator delete[](void* xi_pointer, const std::nothrow_t&) noexcept { deallocate(xi_pointer); }
+
+namespace {
+
+    // element type description
+    template<typename T> struct Type;
+    template<> struct Type<std::int32_t> {
+        static constexpr const char* name{ "int32" };
+        static std::int32_t make(const std::size_t i) { return static_cast<std::int32_t>(i); }
+    };
+    template<> struct Type<std::string> {
+        static constexpr const char* name{ "string" };
+
+        // long enough to defeat the small string optimization, so every element owns a heap buffer
+        static std::string make(const std::size_t i) { return std::string(40, static_cast<char>('a' + i % 26)); }
+    };
+
+    // container description
+    template<typename Container> struct Name;
+    template<typename T> struct Name<std::vector<T>> { static constexpr const char* value{ "std::vector" }; };
+    template<typename T> struct Name<Lazy::Vector<T>> { static constexpr const char* value{ "Lazy::Vector" }; };
+
+    // benchmark configuration
+    struct Configuration {
+        std::vector<std::size_t> sizes;
+        std::string filter;
+        double minimalTime{ 0.05 };
+    };
+
+    bool selected(const Configuration& xi_configuration, const std::string& xi_name) {
+        return xi_configuration.filter.empty() || (xi_name.find(xi_configuration.filter) != std::string::npos);
+    }
+
+    // a container holding a given amount of elements
+    template<typename Container> Container filled(const std::size_t xi_size) {
+        using T = typename Container::value_type;
+
+        Container container;
+        for (std::size_t i{}; i < xi_size; ++i) {
+            container.push_back(Type<T>::make(i));
+        }
+        return container;
+    }
+
+    /**
+    * \brief measure an operation and add it to the report.
+    *        a single invocation is performed first with reset allocation statistics, then the operation is timed.
+    *
+    * @param {size_t,   in} amount of elements the operation processes (duration is reported per element)
+    * @param {Function, in} operation
+    **/
+    template<typename Container, typename Function> void run(Benchmark::Report& xo_report, const Configuration& xi_configuration, const std::string& xi_operation,
+                                                             const std::size_t xi_size, const std::size_t xi_elements, Function&& xi_function) {
+        using T = typename Container::value_type;
+
+        allocations.count = 0;
+        allocations.bytes = 0;
+        allocations.peak = allocations.live;
+        const std::size_t live{ allocations.live };
+        xi_function();
+        const Allocations single{ allocations.count, allocations.bytes, allocations.live, allocations.peak - live };
+
+        const double seconds{ Benchmark::measure(xi_function, xi_configuration.minimalTime) },
+                     nanoseconds{ seconds * 1e9 / static_cast<double>(std::max<std::size_t>(1, xi_elements)) };
+
+        xo_report.add().set("operation", xi_operation)
+                       .set("container", Name<Container>::value)
+                       .set("type", Type<T>::name)
+                       .set("size", xi_size)
+                       .set("ns_per_element", nanoseconds)
+                       .set("allocations", single.count)
+                       .set("allocated_bytes", single.bytes)
+                       .set("peak_heap_bytes", single.peak)
+                       .set("peak_rss_bytes", Benchmark::peak_rss());
+        std::cerr << xi_operation << " " << Name<Container>::value << " " << Type<T>::name << " " << xi_size << ": "
+                  << nanoseconds << " ns/element, " << single.count << " allocations\n";
+    }
+
+    /**
+    * \brief every modifier, for a given container and element type
+    **/
+    template<typename Container> void operations(Benchmark::Report& xo_report, const Configuration& xi_configuration, const std::size_t xi_size) {
+        using T = typename Container::value_type;
+
+        // growth from an empty container
+        if (selected(xi_configuration, "push_back")) {
+            run<Container>(xo_report, xi_configuration, "push_back", xi_size, xi_size, [&]() {
+                Container container;
+                for (std::size_t i{}; i < xi_size; ++i) {
+                    container.push_back(Type<T>::make(i));
+                }
+                Benchmark::keep(container.size());
+            });
+        }
+        if (selected(xi_configuration, "emplace_back")) {
+            run<Container>(xo_report, xi_configuration, "emplace_back", xi_size, xi_size, [&]() {
+                Container container;
+                for (std::size_t i{}; i < xi_size; ++i) {
+                    container.emplace_back(Type<T>::make(i));
+                }
+                Benchmark::keep(container.size());
+            });
+        }
+        if (selected(xi_configuration, "reserve")) {
+            run<Container>(xo_report, xi_configuration, "reserve", xi_size, xi_size, [&]() {
+                Container container;
+                container.reserve(xi_size);
+                Benchmark::keep(container.capacity());
+            });
+        }
+        if (selected(xi_configuration, "resize")) {
+            // sixteen growth steps, then shrink back
+            run<Container>(xo_report, xi_configuration, "resize", xi_size, xi_size, [&]() {
+                Container container;
+                for (std::size_t step{ 1 }; step <= 16; ++step) {
+                    container.resize(std::max<std::size_t>(1, xi_size * step / 16));
+                }
+                container.resize(0);
+                Benchmark::keep(container.capacity());
+            });
+        }
+
+        // operations on a filled container (its size is kept constant, elements shifted are reported)
+        Container source{ filled<Container>(xi_size) };
+        const T value{ Type<T>::make(xi_size) };
+
+        if (selected(xi_configuration, "insert")) {
+            // insert at the middle, remove from the back
+            run<Container>(xo_report, xi_configuration, "insert", xi_size, xi_size / 2, [&]() {
+                source.insert(source.begin() + xi_size / 2, value);
+                source.pop_back();
+                Benchmark::keep(source.size());
+            });
+        }
+        if (selected(xi_configuration, "erase")) {
+            // erase from the middle, append at the back
+            run<Container>(xo_report, xi_configuration, "erase", xi_size, xi_size / 2, [&]() {
+                source.erase(source.begin() + xi_size / 2);
+                source.push_back(value);
+                Benchmark::keep(source.size());
+            });
+        }
+        if (selected(xi_configuration, "copy")) {
+            run<Container>(xo_report, xi_configuration, "copy", xi_size, xi_size, [&]() {
+                const Container& original{ source };
+                Container copy(original);
+                Benchmark::keep(copy.size());
+            });
+        }
+        if (selected(xi_configuration, "move")) {
+            // move construct, then swap the content back into the source
+            run<Container>(xo_report, xi_configuration, "move", xi_size, xi_size, [&]() {
+                Container moved(std::move(source));
+                source.swap(moved);
+                Benchmark::keep(source.size());
+            });
+        }
+        if (selected(xi_configuration, "swap")) {
+            Container other{ filled<Container>(xi_size) };
+            run<Container>(xo_report, xi_configuration, "swap", xi_size, xi_size, [&]() {
+                source.swap(other);
+                Benchmark::keep(source.size());
+            });
+        }
+    }
+
+    template<typename T> void all(Benchmark::Report& xo_report, const Configuration& xi_configuration) {
+        for (const std::size_t size : xi_configuration.sizes) {
+            operations<std::vector<T>>(xo_report, xi_configuration, size);
+            operations<Lazy::Vector<T>>(xo_report, xi_configuration, size);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    const Benchmark::Arguments arguments(argc, argv);
+    const bool quick{ arguments.has("quick") };
+    const std::size_t maximalElements{ std::stoull(arguments.value("max-elements", quick ? "65536" : "4194304")) };
+
+    Configuration configuration;
+    for (std::size_t size{ 1024 }; size <= maximalElements; size *= 16) {
+        configuration.sizes.push_back(size);
+    }
+    configuration.filter = arguments.value("filter");
+    configuration.minimalTime = quick ? 0.01 : 0.05;
+    if (arguments.has("no-pool")) {
+        Lazy::Memory::settings().poolBlockBytes = 0;
+    }
+
+    Benchmark::Report report("containers");
+    all<std::int32_t>(report, configuration);
+    all<std::string>(report, configuration);
+
+    const std::string output{ arguments.value("output") };
+    if (output.empty()) {
+        report.write(std::cout);
+    }
+    else {
+        std::ofstream file(output);
+        report.write(file);
+    }
+
+    return 0;
+}
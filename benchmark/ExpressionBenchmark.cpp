@@ -0,0 +1,285 @@
+/**
+* Expression evaluation benchmark - every operator, expression depths 1 to 10 and the README expression (against a std::vector loop),
+* for int32, float, double and a user defined type, over working sets sweeping L1 -> L2 -> LLC -> DRAM.
+* Results (ns/element, GB/s, GFLOP/s) are written as JSON.
+*
+* build: g++ -std=c++17 -O3 -DNDEBUG -march=native ExpressionBenchmark.cpp -o ExpressionBenchmark
+* usage: ExpressionBenchmark [--quick] [--output=file.json] [--max-bytes=bytes] [--filter=name]
+*        --quick     - skip DRAM level and shorten measurements
+*        --max-bytes - maximal working set at DRAM level (default 512MB)
+*        --filter    - only run benchmarks whose name contains this string
+*
+* Dan Israel Malta
+**/
+#include "../LazyVector.h"
+#include "Benchmark.h"
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+    /**
+    * \brief a user defined element type (complex number)
+    **/
+    struct Complex {
+        float re{};
+        float im{};
+
+        Complex() = default;
+        Complex(const float xi_re, const float xi_im = 0.0f) : re(xi_re), im(xi_im) {}
+
+        Complex& operator +=(const Complex& b) { re += b.re; im += b.im; return *this; }
+        Complex& operator -=(const Complex& b) { re -= b.re; im -= b.im; return *this; }
+        Complex& operator *=(const Complex& b) { const float r{ re * b.re - im * b.im }; im = re * b.im + im * b.re; re = r; return *this; }
+        Complex& operator /=(const Complex& b) {
+            const float d{ b.re * b.re + b.im * b.im },
+                        r{ (re * b.re + im * b.im) / d };
+            im = (im * b.re - re * b.im) / d;
+            re = r;
+            return *this;
+        }
+    };
+    Complex operator +(Complex a, const Complex& b) { return a += b; }
+    Complex operator -(Complex a, const Complex& b) { return a -= b; }
+    Complex operator *(Complex a, const Complex& b) { return a *= b; }
+    Complex operator /(Complex a, const Complex& b) { return a /= b; }
+
+    // element type description
+    template<typename T> struct Type;
+    template<> struct Type<std::int32_t> {
+        static constexpr const char* name{ "int32" };
+        static constexpr double flops{ 1.0 };   // floating point operations per element wise operation
+        static std::int32_t make(const std::size_t i, const std::size_t k) { return static_cast<std::int32_t>(1 + (i + k) % 7); }
+    };
+    template<> struct Type<float> {
+        static constexpr const char* name{ "float" };
+        static constexpr double flops{ 1.0 };
+        static float make(const std::size_t i, const std::size_t k) { return 1.0f + static_cast<float>((i + k) % 7) * 0.125f; }
+    };
+    template<> struct Type<double> {
+        static constexpr const char* name{ "double" };
+        static constexpr double flops{ 1.0 };
+        static double make(const std::size_t i, const std::size_t k) { return 1.0 + static_cast<double>((i + k) % 7) * 0.125; }
+    };
+    template<> struct Type<Complex> {
+        static constexpr const char* name{ "complex" };
+        static constexpr double flops{ 4.0 };   // average of add (2) and multiply (6)
+        static Complex make(const std::size_t i, const std::size_t k) { return Complex(1.0f + static_cast<float>((i + k) % 7) * 0.125f, 0.5f); }
+    };
+
+    // benchmark configuration
+    struct Configuration {
+        std::vector<Benchmark::Level> levels;
+        std::string filter;
+        double minimalTime{ 0.05 };
+    };
+
+    /**
+    * \brief operands of a benchmark (five vectors: four operands and a result)
+    **/
+    template<typename T> struct Operands {
+        Lazy::Vector<T> a, b, c, d, r;
+
+        explicit Operands(const std::size_t xi_size) : a(xi_size), b(xi_size), c(xi_size), d(xi_size), r(xi_size) {
+            for (std::size_t i{}; i < xi_size; ++i) {
+                a[i] = Type<T>::make(i, 0);
+                b[i] = Type<T>::make(i, 1);
+                c[i] = Type<T>::make(i, 2);
+                d[i] = Type<T>::make(i, 3);
+                r[i] = Type<T>::make(i, 4);
+            }
+        }
+    };
+
+    /**
+    * \brief measure an evaluation and add it to the report
+    *
+    * @param {size_t, in} bytes moved (read + written) per element
+    * @param {double, in} arithmetic operations per element
+    **/
+    template<typename T, typename Function> void run(Benchmark::Report& xo_report, const Configuration& xi_configuration, const std::string& xi_group, const std::string& xi_name,
+                                                     const std::size_t xi_depth, const Benchmark::Level& xi_level, const std::size_t xi_size,
+                                                     const std::size_t xi_bytes, const double xi_operations, Function&& xi_function) {
+        const double seconds{ Benchmark::measure(xi_function, xi_configuration.minimalTime) },
+                     elements{ static_cast<double>(xi_size) };
+
+        xo_report.add().set("group", xi_group)
+                       .set("name", xi_name)
+                       .set("type", Type<T>::name)
+                       .set("depth", xi_depth)
+                       .set("level", xi_level.name)
+                       .set("elements", xi_size)
+                       .set("ns_per_element", seconds * 1e9 / elements)
+                       .set("gb_per_s", static_cast<double>(xi_bytes) * elements / seconds * 1e-9)
+                       .set("gflop_per_s", xi_operations * Type<T>::flops * elements / seconds * 1e-9);
+        std::cerr << xi_group << " " << xi_name << " " << Type<T>::name << " " << xi_level.name << ": " << seconds * 1e9 / elements << " ns/element\n";
+    }
+
+    bool selected(const Configuration& xi_configuration, const std::string& xi_name) {
+        return xi_configuration.filter.empty() || (xi_name.find(xi_configuration.filter) != std::string::npos);
+    }
+
+    // amount of elements of type T so that five vectors occupy a given amount of bytes
+    template<typename T> std::size_t elements(const Benchmark::Level& xi_level) {
+        return std::max<std::size_t>(64, xi_level.bytes / (5 * sizeof(T)));
+    }
+
+    /**
+    * \brief every operator (binary, relational/logical and compound assignment)
+    **/
+    template<typename T> void operators(Benchmark::Report& xo_report, const Configuration& xi_configuration) {
+        for (const Benchmark::Level& level : xi_configuration.levels) {
+            const std::size_t len{ elements<T>(level) };
+            Operands<T> v(len);
+            Lazy::Vector<T>& a{ v.a };
+            Lazy::Vector<T>& b{ v.b };
+            Lazy::Vector<T>& r{ v.r };
+
+            // 'r = a op b' reads two vectors and writes one, 'r op= a' reads two vectors (r and a) and writes one
+            const std::size_t bytes{ 3 * sizeof(T) };
+#define BENCHMARK_OPERATOR(xi_name, xi_statement)                                                                                           \
+            if (selected(xi_configuration, xi_name)) {                                                                                      \
+                run<T>(xo_report, xi_configuration, "operator", xi_name, 1, level, len, bytes, 1.0, [&]() { xi_statement; Benchmark::keep(r[0]); }); \
+            }
+
+            BENCHMARK_OPERATOR("+", r = a + b);
+            BENCHMARK_OPERATOR("-", r = a - b);
+            BENCHMARK_OPERATOR("*", r = a * b);
+            BENCHMARK_OPERATOR("/", r = a / b);
+            BENCHMARK_OPERATOR("+=", r += a);
+            BENCHMARK_OPERATOR("-=", r -= a);
+            BENCHMARK_OPERATOR("*=", (r *= a, r /= a));
+            BENCHMARK_OPERATOR("/=", (r /= a, r *= a));
+
+            if constexpr (std::is_integral<T>::value) {
+                BENCHMARK_OPERATOR("&", r = a & b);
+                BENCHMARK_OPERATOR("|", r = a | b);
+                BENCHMARK_OPERATOR("^", r = a ^ b);
+                BENCHMARK_OPERATOR("<<", r = a << b);
+                BENCHMARK_OPERATOR(">>", r = a >> b);
+                BENCHMARK_OPERATOR("&=", r &= a);
+                BENCHMARK_OPERATOR("|=", r |= a);
+                BENCHMARK_OPERATOR("^=", r ^= a);
+                BENCHMARK_OPERATOR("<<=", (r <<= a, r >>= a));
+                BENCHMARK_OPERATOR(">>=", (r >>= a, r <<= a));
+            }
+
+            if constexpr (std::is_arithmetic<T>::value) {
+                BENCHMARK_OPERATOR("==", r = a == b);
+                BENCHMARK_OPERATOR("!=", r = a != b);
+                BENCHMARK_OPERATOR("<", r = a < b);
+                BENCHMARK_OPERATOR("<=", r = a <= b);
+                BENCHMARK_OPERATOR(">", r = a > b);
+                BENCHMARK_OPERATOR(">=", r = a >= b);
+                BENCHMARK_OPERATOR("&&", r = a && b);
+                BENCHMARK_OPERATOR("||", r = a || b);
+            }
+#undef BENCHMARK_OPERATOR
+        }
+    }
+
+    /**
+    * \brief hand over a left deep expression of a given depth ('a + b * c + d * a ...') to a sink
+    *        (expressions refer to temporaries, so they are built and consumed within nested calls)
+    **/
+    template<std::size_t Depth, typename T, typename Sink> void chain(Operands<T>& xi_operands, Sink&& xi_sink) {
+        if constexpr (Depth == 0) {
+            xi_sink(xi_operands.a);
+        }
+        else {
+            const Lazy::Vector<T>* vectors[]{ &xi_operands.a, &xi_operands.b, &xi_operands.c, &xi_operands.d };
+            const Lazy::Vector<T>& operand{ *vectors[Depth % 4] };
+            chain<Depth - 1>(xi_operands, [&](const auto& xi_expression) {
+                if constexpr ((Depth % 2) == 1) {
+                    xi_sink(xi_expression + operand);
+                }
+                else {
+                    xi_sink(xi_expression * operand);
+                }
+            });
+        }
+    }
+
+    template<typename T, std::size_t Depth> void depth(Benchmark::Report& xo_report, const Configuration& xi_configuration) {
+        if constexpr (Depth <= 10) {
+            const std::string name{ "depth " + std::to_string(Depth) };
+            if (selected(xi_configuration, name)) {
+                for (const Benchmark::Level& level : xi_configuration.levels) {
+                    const std::size_t len{ elements<T>(level) };
+                    Operands<T> v(len);
+
+                    // distinct vectors read (up to four) and written
+                    const std::size_t bytes{ (std::min<std::size_t>(Depth + 1, 4) + 1) * sizeof(T) };
+                    run<T>(xo_report, xi_configuration, "depth", name, Depth, level, len, bytes, static_cast<double>(Depth), [&]() {
+                        chain<Depth>(v, [&](const auto& xi_expression) { v.r = xi_expression; });
+                        Benchmark::keep(v.r[0]);
+                    });
+                }
+            }
+
+            depth<T, Depth + 1>(xo_report, xi_configuration);
+        }
+    }
+
+    /**
+    * \brief the README expression, lazy evaluated against a std::vector loop
+    **/
+    template<typename T> void readme(Benchmark::Report& xo_report, const Configuration& xi_configuration) {
+        if (!selected(xi_configuration, "readme")) return;
+
+        for (const Benchmark::Level& level : xi_configuration.levels) {
+            const std::size_t len{ elements<T>(level) };
+            Operands<T> v(len);
+            std::vector<T> a0(v.a.cbegin(), v.a.cend()), b0(v.b.cbegin(), v.b.cend()), c0(v.c.cbegin(), v.c.cend()), d0(v.d.cbegin(), v.d.cend());
+
+            // four vectors read, one written, seven operations
+            const std::size_t bytes{ 5 * sizeof(T) };
+            run<T>(xo_report, xi_configuration, "readme", "std::vector", 3, level, len, bytes, 7.0, [&]() {
+                for (std::size_t i{}; i < len; ++i) {
+                    d0[i] -= (a0[i] * b0[i] + c0[i]) + (b0[i] / c0[i]) * (a0[i] / c0[i]);
+                }
+                Benchmark::keep(d0[0]);
+            });
+            run<T>(xo_report, xi_configuration, "readme", "Lazy::Vector", 3, level, len, bytes, 7.0, [&]() {
+                v.d -= (v.a * v.b + v.c) + (v.b / v.c) * (v.a / v.c);
+                Benchmark::keep(v.d[0]);
+            });
+        }
+    }
+
+    template<typename T> void all(Benchmark::Report& xo_report, const Configuration& xi_configuration) {
+        operators<T>(xo_report, xi_configuration);
+        depth<T, 1>(xo_report, xi_configuration);
+        readme<T>(xo_report, xi_configuration);
+    }
+}
+
+int main(int argc, char** argv) {
+    const Benchmark::Arguments arguments(argc, argv);
+    const bool quick{ arguments.has("quick") };
+
+    Configuration configuration;
+    configuration.levels = Benchmark::levels(std::stoull(arguments.value("max-bytes", "536870912")), quick);
+    configuration.filter = arguments.value("filter");
+    configuration.minimalTime = quick ? 0.01 : 0.05;
+
+    Benchmark::Report report("expressions");
+    all<std::int32_t>(report, configuration);
+    all<float>(report, configuration);
+    all<double>(report, configuration);
+    all<Complex>(report, configuration);
+
+    const std::string output{ arguments.value("output") };
+    if (output.empty()) {
+        report.write(std::cout);
+    }
+    else {
+        std::ofstream file(output);
+        report.write(file);
+    }
+
+    return 0;
+}
@@ -0,0 +1,277 @@
+/**
+* Parallel scaling benchmark - evaluates a set of expressions with 1..N threads (Evaluation::Strategy::Parallel), and compares
+* the achieved bandwidth with a STREAM style triad (a = b + s * c) measured with the same amount of threads on this machine.
+* A roofline style summary (arithmetic intensity against achieved throughput, memory and compute roofs) is printed per expression.
+* Results (ns/element, GB/s, GFLOP/s, speedup, fraction of triad bandwidth) are written as JSON.
+*
+* build: g++ -std=c++17 -O3 -DNDEBUG -march=native -pthread ParallelScaling.cpp -o ParallelScaling
+* usage: ParallelScaling [--quick] [--output=file.json] [--threads=count] [--elements=count] [--filter=name]
+*        --quick    - smaller vectors (LLC sized) and shorter measurements
+*        --threads  - maximal amount of threads (default hardware concurrency)
+*        --elements - elements per vector (default 8M doubles, 64MB per vector)
+*        --filter   - only run expressions whose name contains this string
+*
+* Dan Israel Malta
+**/
+#include "../LazyVector.h"
+#include "Benchmark.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    // benchmark configuration
+    struct Configuration {
+        std::size_t threads{ 1 };
+        std::size_t elements{ 1 << 23 };
+        std::string filter;
+        double minimalTime{ 0.2 };
+    };
+
+    // throughput of a single measurement
+    struct Throughput {
+        double seconds{};
+        double bytesPerSecond{};
+        double flopsPerSecond{};
+    };
+
+    Throughput throughput(const double xi_seconds, const std::size_t xi_elements, const std::size_t xi_bytes, const double xi_flops) {
+        const double elements{ static_cast<double>(xi_elements) };
+        return { xi_seconds, static_cast<double>(xi_bytes) * elements / xi_seconds, xi_flops * elements / xi_seconds };
+    }
+
+    // execute a function over [0, count) split statically into one contiguous chunk per thread
+    template<typename Function> void split(const std::size_t xi_threads, const std::size_t xi_count, Function&& xi_function) {
+        const std::size_t chunk{ (xi_count + xi_threads - 1) / xi_threads };
+        std::vector<std::thread> threads;
+        for (std::size_t t{ 1 }; t < xi_threads; ++t) {
+            threads.emplace_back([&, t]() { xi_function(std::min(xi_count, t * chunk), std::min(xi_count, (t + 1) * chunk)); });
+        }
+        xi_function(0, std::min(xi_count, chunk));
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    /**
+    * \brief STREAM style triad (a = b + s * c) over plain arrays, first touched by the threads which later use them
+    **/
+    Throughput triad(const Configuration& xi_configuration, const std::size_t xi_threads) {
+        const std::size_t len{ xi_configuration.elements };
+        std::unique_ptr<double[]> a(new double[len]), b(new double[len]), c(new double[len]);
+        split(xi_threads, len, [&](const std::size_t xi_first, const std::size_t xi_last) {
+            for (std::size_t i{ xi_first }; i < xi_last; ++i) {
+                a[i] = 0.0;
+                b[i] = 1.0;
+                c[i] = 2.0;
+            }
+        });
+
+        const double scalar{ 3.0 };
+        const double seconds{ Benchmark::measure([&]() {
+            split(xi_threads, len, [&, scalar](const std::size_t xi_first, const std::size_t xi_last) {
+                double* const out{ a.get() };
+                const double* const left{ b.get() };
+                const double* const right{ c.get() };
+                for (std::size_t i{ xi_first }; i < xi_last; ++i) {
+                    out[i] = left[i] + scalar * right[i];
+                }
+            });
+            Benchmark::keep(a[0]);
+        }, xi_configuration.minimalTime) };
+
+        // two streams read, one written
+        return throughput(seconds, len, 3 * sizeof(double), 2.0);
+    }
+
+    /**
+    * \brief attainable compute throughput - a multiply-add over an L1 resident array, repeated
+    **/
+    Throughput compute(const Configuration& xi_configuration, const std::size_t xi_threads) {
+        constexpr std::size_t length{ 1024 },
+                              repetitions{ 4096 };
+        const double seconds{ Benchmark::measure([&]() {
+            split(xi_threads, xi_threads, [&](const std::size_t, const std::size_t) {
+                double values[length];
+                for (std::size_t i{}; i < length; ++i) {
+                    values[i] = static_cast<double>(i);
+                }
+                for (std::size_t r{}; r < repetitions; ++r) {
+                    for (std::size_t i{}; i < length; ++i) {
+                        values[i] = values[i] * 0.999 + 0.001;
+                    }
+                }
+                Benchmark::keep(values[0]);
+            });
+        }, xi_configuration.minimalTime) };
+
+        return throughput(seconds, length * repetitions * xi_threads, 0, 2.0);
+    }
+
+    /**
+    * \brief an expression under test
+    **/
+    struct Expression {
+        const char* name;
+        std::size_t bytes;      // bytes moved (read + written) per element
+        double flops;           // floating point operations per element
+    };
+
+    // operands of all expressions
+    struct Operands {
+        Lazy::Vector<double> a, b, c, d, r;
+
+        explicit Operands(const std::size_t xi_size) : a(xi_size), b(xi_size), c(xi_size), d(xi_size), r(xi_size) {
+            for (std::size_t i{}; i < xi_size; ++i) {
+                a[i] = 1.0 + static_cast<double>(i % 7) * 0.125;
+                b[i] = 2.0 + static_cast<double>(i % 5) * 0.125;
+                c[i] = 3.0 + static_cast<double>(i % 3) * 0.125;
+                d[i] = 1.0;
+                r[i] = 0.0;
+            }
+        }
+    };
+
+    // amount of hardware threads
+    std::size_t hardware() {
+        return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    bool selected(const Configuration& xi_configuration, const std::string& xi_name) {
+        return xi_configuration.filter.empty() || (xi_name.find(xi_configuration.filter) != std::string::npos);
+    }
+}
+
+int main(int argc, char** argv) {
+    const Benchmark::Arguments arguments(argc, argv);
+    const bool quick{ arguments.has("quick") };
+
+    Configuration configuration;
+    configuration.threads = std::stoull(arguments.value("threads", std::to_string(hardware())));
+    configuration.elements = std::stoull(arguments.value("elements", quick ? "1048576" : "8388608"));
+    configuration.filter = arguments.value("filter");
+    configuration.minimalTime = quick ? 0.05 : 0.2;
+
+    Operands v(configuration.elements);
+    Lazy::Vector<double>& a{ v.a };
+    Lazy::Vector<double>& b{ v.b };
+    Lazy::Vector<double>& c{ v.c };
+    Lazy::Vector<double>& d{ v.d };
+    Lazy::Vector<double>& r{ v.r };
+    const auto s{ Lazy::scalar(0.5) };
+
+    // expressions, from memory bound to compute bound (bytes count distinct vectors read and written)
+    struct Case {
+        Expression expression;
+        std::function<void()> evaluate;
+    };
+    const std::vector<Case> cases{
+        { { "shift",  2 * sizeof(double), 1.0 },  [&]() { r = a + s; } },
+        { { "scale",  2 * sizeof(double), 1.0 },  [&]() { r = a * s; } },
+        { { "add",    3 * sizeof(double), 1.0 },  [&]() { r = a + b; } },
+        { { "triad",  3 * sizeof(double), 2.0 },  [&]() { r = a + b * s; } },
+        { { "readme", 5 * sizeof(double), 7.0 },  [&]() { d -= (a * b + c) + (b / c) * (a / c); } },
+        { { "polynomial", 2 * sizeof(double), 16.0 }, [&]() { r = ((((((((a * s + s) * a + s) * a + s) * a + s) * a + s) * a + s) * a + s) * a + s); } }
+    };
+
+    Benchmark::Report report("parallel scaling");
+    Lazy::Evaluation::Settings& settings{ Lazy::Evaluation::settings() };
+    settings.strategy = Lazy::Evaluation::Strategy::Parallel;
+
+    // the evaluation scheduler is sized on first use, make sure it holds the maximal amount of threads
+    settings.threads = configuration.threads;
+    Lazy::Evaluation::scheduler();
+
+    // triad baseline and compute roof per thread count
+    std::vector<Throughput> triads(configuration.threads + 1),
+                            computes(configuration.threads + 1);
+    for (std::size_t threads{ 1 }; threads <= configuration.threads; ++threads) {
+        triads[threads] = triad(configuration, threads);
+        computes[threads] = compute(configuration, threads);
+
+        report.add().set("kind", "baseline")
+                    .set("name", "stream triad")
+                    .set("threads", threads)
+                    .set("ns_per_element", triads[threads].seconds * 1e9 / static_cast<double>(configuration.elements))
+                    .set("gb_per_s", triads[threads].bytesPerSecond * 1e-9)
+                    .set("gflop_per_s", triads[threads].flopsPerSecond * 1e-9)
+                    .set("speedup", triads[1].seconds / triads[threads].seconds);
+        report.add().set("kind", "baseline")
+                    .set("name", "compute")
+                    .set("threads", threads)
+                    .set("gflop_per_s", computes[threads].flopsPerSecond * 1e-9)
+                    .set("speedup", computes[threads].flopsPerSecond / computes[1].flopsPerSecond);
+        std::cerr << "baseline " << threads << " threads: triad " << triads[threads].bytesPerSecond * 1e-9 << " GB/s, compute "
+                  << computes[threads].flopsPerSecond * 1e-9 << " GFLOP/s\n";
+    }
+
+    // expressions at every thread count
+    std::vector<std::vector<Throughput>> results;
+    for (const Case& test : cases) {
+        results.emplace_back(configuration.threads + 1);
+        if (!selected(configuration, test.expression.name)) continue;
+
+        std::vector<Throughput>& measured{ results.back() };
+        for (std::size_t threads{ 1 }; threads <= configuration.threads; ++threads) {
+            settings.threads = threads;
+            measured[threads] = throughput(Benchmark::measure(test.evaluate, configuration.minimalTime), configuration.elements, test.expression.bytes, test.expression.flops);
+
+            report.add().set("kind", "expression")
+                        .set("name", test.expression.name)
+                        .set("threads", threads)
+                        .set("ns_per_element", measured[threads].seconds * 1e9 / static_cast<double>(configuration.elements))
+                        .set("gb_per_s", measured[threads].bytesPerSecond * 1e-9)
+                        .set("gflop_per_s", measured[threads].flopsPerSecond * 1e-9)
+                        .set("speedup", measured[1].seconds / measured[threads].seconds)
+                        .set("triad_fraction", measured[threads].bytesPerSecond / triads[threads].bytesPerSecond);
+            std::cerr << test.expression.name << " " << threads << " threads: " << measured[threads].bytesPerSecond * 1e-9 << " GB/s, speedup "
+                      << measured[1].seconds / measured[threads].seconds << "\n";
+        }
+    }
+    settings.strategy = Lazy::Evaluation::Strategy::Automatic;
+    settings.threads = 1;
+
+    // roofline summary at the maximal amount of threads - attainable throughput is min(compute roof, intensity * triad bandwidth)
+    const std::size_t n{ configuration.threads };
+    std::fprintf(stderr, "\nroofline (%zu threads, triad %.1f GB/s, compute %.1f GFLOP/s)\n", n, triads[n].bytesPerSecond * 1e-9, computes[n].flopsPerSecond * 1e-9);
+    std::fprintf(stderr, "%-12s %10s %12s %12s %12s %8s %10s %8s\n", "expression", "flop/byte", "GFLOP/s", "GB/s", "roof GFLOP", "of roof", "bound", "speedup");
+    for (std::size_t i{}; i < cases.size(); ++i) {
+        const Expression& expression{ cases[i].expression };
+        const Throughput& measured{ results[i][n] };
+        if (measured.seconds <= 0.0) continue;
+
+        const double intensity{ expression.flops / static_cast<double>(expression.bytes) },
+                     memoryRoof{ intensity * triads[n].bytesPerSecond },
+                     roof{ std::min(memoryRoof, computes[n].flopsPerSecond) },
+                     achieved{ measured.flopsPerSecond };
+        const char* bound{ (memoryRoof < computes[n].flopsPerSecond) ? "memory" : "compute" };
+
+        std::fprintf(stderr, "%-12s %10.3f %12.2f %12.2f %12.2f %7.0f%% %10s %8.2f\n", expression.name, intensity, achieved * 1e-9,
+                     measured.bytesPerSecond * 1e-9, roof * 1e-9, 100.0 * achieved / roof,
+                     bound, results[i][1].seconds / measured.seconds);
+
+        report.add().set("kind", "roofline")
+                    .set("name", expression.name)
+                    .set("threads", n)
+                    .set("arithmetic_intensity", intensity)
+                    .set("gflop_per_s", achieved * 1e-9)
+                    .set("gb_per_s", measured.bytesPerSecond * 1e-9)
+                    .set("roof_gflop_per_s", roof * 1e-9)
+                    .set("bound", bound);
+    }
+
+    const std::string output{ arguments.value("output") };
+    if (output.empty()) {
+        report.write(std::cout);
+    }
+    else {
+        std::ofstream file(output);
+        report.write(file);
+    }
+
+    return 0;
+}
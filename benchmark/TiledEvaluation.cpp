@@ -0,0 +1,51 @@
+/**
+* Compares fused (single loop) evaluation against tiled evaluation for expressions of growing width.
+*
+* build: g++ -std=c++17 -O3 -DNDEBUG -march=native TiledEvaluation.cpp -o TiledEvaluation
+*
+* Dan Israel Malta
+**/
+#include "../LazyVector.h"
+#include <chrono>
+#include <iostream>
+
+namespace {
+
+    // best of a few repetitions (in microseconds) of a given assignment, under a given strategy
+    template<typename Function> long long measure(const Lazy::Evaluation::Strategy xi_strategy, Function&& xi_function) {
+        Lazy::Evaluation::settings().strategy = xi_strategy;
+
+        long long best{ -1 };
+        for (int repetition{}; repetition < 7; ++repetition) {
+            const auto start{ std::chrono::steady_clock::now() };
+            xi_function();
+            const auto end{ std::chrono::steady_clock::now() };
+
+            const long long duration{ std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() };
+            if ((best < 0) || (duration < best)) {
+                best = duration;
+            }
+        }
+
+        Lazy::Evaluation::settings().strategy = Lazy::Evaluation::Strategy::Automatic;
+        return best;
+    }
+
+    template<typename Function> void compare(const char* xi_name, Function&& xi_function) {
+        const long long fused{ measure(Lazy::Evaluation::Strategy::Fused, xi_function) },
+                        tiled{ measure(Lazy::Evaluation::Strategy::Tiled, xi_function) };
+        std::cout << xi_name << ": fused " << fused << "us, tiled " << tiled << "us, speedup " << static_cast<double>(fused) / static_cast<double>(tiled) << "\n";
+    }
+}
+
+int main() {
+    const std::size_t len{ 1 << 22 };
+    Lazy::Vector<float> a(len, 1.0f), b(len, 2.0f), c(len, 3.0f), d(len, 4.0f), e(len, 5.0f), f(len, 6.0f), r(len);
+
+    compare("4 operands  ", [&]() { r = (a + b) * (c - d); });
+    compare("7 operands  ", [&]() { r -= (a + b + c) + (b / c) * (a / c); });
+    compare("10 operands ", [&]() { r = ((a * b + c) * (d - e)) + ((f / a) * (b + c)) - (d * e); });
+    compare("14 operands ", [&]() { r = ((a + b + c) + (b / c) * (a / c)) - ((d * e + f) * (a - e) + (f / d) * (c + b)); });
+
+    return 0;
+}